@@ -0,0 +1,262 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file Copyright.txt or https://cmake.org/licensing for details.  */
+#include "cmCMakeImportTargetsCommand.h"
+
+#include <memory>
+
+#include <cm/string_view>
+#include <cmext/string_view>
+
+#include <cm3p/json/reader.h>
+#include <cm3p/json/value.h>
+
+#include "cmExecutionStatus.h"
+#include "cmGeneratorExpression.h"
+#include "cmMakefile.h"
+#include "cmMessageType.h"
+#include "cmPolicies.h"
+#include "cmState.h"
+#include "cmStateTypes.h"
+#include "cmStringAlgorithms.h"
+#include "cmSystemTools.h"
+#include "cmTarget.h"
+
+namespace {
+
+struct ImportedTargetType
+{
+  cm::static_string_view Name;
+  cmStateEnums::TargetType Type;
+};
+
+ImportedTargetType const ImportedTargetTypes[] = {
+  { "EXECUTABLE"_s, cmStateEnums::EXECUTABLE },
+  { "STATIC"_s, cmStateEnums::STATIC_LIBRARY },
+  { "SHARED"_s, cmStateEnums::SHARED_LIBRARY },
+  { "MODULE"_s, cmStateEnums::MODULE_LIBRARY },
+  { "UNKNOWN"_s, cmStateEnums::UNKNOWN_LIBRARY },
+  { "OBJECT"_s, cmStateEnums::OBJECT_LIBRARY },
+  { "INTERFACE"_s, cmStateEnums::INTERFACE_LIBRARY },
+};
+
+// Expand the variable references that export files leave unescaped in
+// property values.  Everything else is taken literally.
+class ImportReferences
+{
+public:
+  ImportReferences(cmMakefile const& mf)
+    : Prefix(mf.GetSafeDefinition("_IMPORT_PREFIX"))
+    , ImportLibrarySuffix(mf.GetSafeDefinition("CMAKE_IMPORT_LIBRARY_SUFFIX"))
+  {
+  }
+
+  std::string Expand(std::string value) const
+  {
+    if (value.find("${") != std::string::npos) {
+      cmSystemTools::ReplaceString(value, "${_IMPORT_PREFIX}", this->Prefix);
+      cmSystemTools::ReplaceString(value, "${CMAKE_IMPORT_LIBRARY_SUFFIX}",
+                                   this->ImportLibrarySuffix);
+    }
+    return value;
+  }
+
+private:
+  std::string const Prefix;
+  std::string const ImportLibrarySuffix;
+};
+
+cmTarget* CreateImportedTarget(std::string const& name,
+                               std::string const& typeName,
+                               cmExecutionStatus& status)
+{
+  cmMakefile& mf = status.GetMakefile();
+
+  ImportedTargetType const* importedType = nullptr;
+  for (ImportedTargetType const& t : ImportedTargetTypes) {
+    if (t.Name == typeName) {
+      importedType = &t;
+      break;
+    }
+  }
+  if (!importedType) {
+    status.SetError(cmStrCat("given unknown type \"", typeName,
+                             "\" for imported target \"", name, "\"."));
+    return nullptr;
+  }
+  cmStateEnums::TargetType type = importedType->Type;
+
+  if (!cmGeneratorExpression::IsValidTargetName(name)) {
+    status.SetError(cmStrCat("given invalid imported target name: ", name));
+    return nullptr;
+  }
+
+  // Follow add_library() for platforms without shared libraries.
+  if ((type == cmStateEnums::SHARED_LIBRARY ||
+       type == cmStateEnums::MODULE_LIBRARY) &&
+      !mf.GetState()->GetGlobalPropertyAsBool("TARGET_SUPPORTS_SHARED_LIBS")) {
+    std::string const msg =
+      cmStrCat("Imported target \"", name, "\" has ", typeName,
+               " type but the target platform does not support dynamic "
+               "linking.");
+    switch (mf.GetPolicyStatus(cmPolicies::CMP0164)) {
+      case cmPolicies::WARN:
+        mf.IssueMessage(MessageType::AUTHOR_WARNING,
+                        cmStrCat(msg, " Importing a STATIC library instead."));
+        CM_FALLTHROUGH;
+      case cmPolicies::OLD:
+        type = cmStateEnums::STATIC_LIBRARY;
+        break;
+      case cmPolicies::NEW:
+      case cmPolicies::REQUIRED_IF_USED:
+      case cmPolicies::REQUIRED_ALWAYS:
+        mf.IssueMessage(MessageType::FATAL_ERROR, msg);
+        cmSystemTools::SetFatalErrorOccurred();
+        return nullptr;
+    }
+  }
+
+  // Make sure the target does not already exist.
+  if (mf.FindTargetToUse(name)) {
+    status.SetError(cmStrCat(
+      "cannot create imported target \"", name,
+      "\" because another target with the same name already exists."));
+    return nullptr;
+  }
+
+  return mf.AddImportedTarget(name, type, mf.IsImportedTargetGlobalScope());
+}
+}
+
+bool cmCMakeImportTargetsCommand(std::vector<std::string> const& args,
+                                 cmExecutionStatus& status)
+{
+  if (args.size() != 2 || args[0] != "JSON"_s) {
+    status.SetError("requires exactly one JSON argument.");
+    return false;
+  }
+
+  Json::CharReaderBuilder builder;
+  builder["collectComments"] = false;
+  builder["failIfExtra"] = true;
+  builder["strictRoot"] = true;
+  std::unique_ptr<Json::CharReader> const reader(builder.newCharReader());
+
+  std::string const& text = args[1];
+  Json::Value root;
+  std::string errors;
+  if (!reader->parse(text.data(), text.data() + text.size(), &root,
+                     &errors)) {
+    status.SetError(cmStrCat("given invalid JSON:\n", errors));
+    return false;
+  }
+  if (!root.isObject() || !root["targets"].isArray() ||
+      !(root["configuration"].isNull() || root["configuration"].isString())) {
+    status.SetError("given JSON that does not describe imported targets.");
+    return false;
+  }
+  Json::Value const& targets = root["targets"];
+  Json::Value const& configuration = root["configuration"];
+
+  cmMakefile& mf = status.GetMakefile();
+  ImportReferences const references(mf);
+  std::string const config = configuration.asString();
+  std::string checkTargets;
+
+  for (Json::Value const& entry : targets) {
+    if (!entry.isObject() || !entry["name"].isString() ||
+        !(entry["properties"].isNull() || entry["properties"].isObject())) {
+      status.SetError("given an invalid imported target description.");
+      return false;
+    }
+    Json::Value const& name = entry["name"];
+    std::string const targetName = name.asString();
+
+    cmTarget* target = nullptr;
+    Json::Value const& type = entry["type"];
+    if (!type.isNull() && !type.isString()) {
+      status.SetError(
+        cmStrCat("given a non-string type for imported target \"", targetName,
+                 "\"."));
+      return false;
+    }
+    if (type.isString()) {
+      target = CreateImportedTarget(targetName, type.asString(), status);
+      if (!target) {
+        return false;
+      }
+    } else {
+      if (mf.IsAlias(targetName)) {
+        status.SetError("can not be used on an ALIAS target.");
+        return false;
+      }
+      target = mf.FindTargetToUse(targetName);
+      if (!target) {
+        status.SetError(
+          cmStrCat("Can not find target to add properties to: ", targetName));
+        return false;
+      }
+    }
+
+    if (!config.empty()) {
+      target->AppendProperty("IMPORTED_CONFIGURATIONS", config,
+                             mf.GetBacktrace());
+    }
+
+    Json::Value const& properties = entry["properties"];
+    for (auto i = properties.begin(); i != properties.end(); ++i) {
+      std::string const property = i.name();
+      if (!i->isString()) {
+        status.SetError(cmStrCat("given a non-string value for property \"",
+                                 property, "\" of target \"", targetName,
+                                 "\"."));
+        return false;
+      }
+      target->SetProperty(property, references.Expand(i->asString()));
+      target->CheckProperty(property, &mf);
+    }
+
+    // Record the files that the export file verifies after loading.
+    Json::Value const& checkFiles = entry["importCheckFiles"];
+    if (!checkFiles.isNull() && !checkFiles.isArray()) {
+      status.SetError(
+        cmStrCat("given invalid import check files for target \"", targetName,
+                 "\"."));
+      return false;
+    }
+    if (checkFiles.isArray()) {
+      if (!checkTargets.empty()) {
+        checkTargets += ';';
+      }
+      checkTargets += targetName;
+
+      std::string const filesVar =
+        cmStrCat("_cmake_import_check_files_for_", targetName);
+      std::string files = mf.GetSafeDefinition(filesVar);
+      for (Json::Value const& file : checkFiles) {
+        if (!file.isString()) {
+          status.SetError(cmStrCat(
+            "given a non-string import check file for target \"", targetName,
+            "\"."));
+          return false;
+        }
+        if (!files.empty()) {
+          files += ';';
+        }
+        files += references.Expand(file.asString());
+      }
+      mf.AddDefinition(filesVar, files);
+    }
+  }
+
+  if (!checkTargets.empty()) {
+    std::string const targetsVar = "_cmake_import_check_targets";
+    std::string value = mf.GetSafeDefinition(targetsVar);
+    if (!value.empty()) {
+      value += ';';
+    }
+    value += checkTargets;
+    mf.AddDefinition(targetsVar, value);
+  }
+
+  return true;
+}
@@ -0,0 +1,20 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file Copyright.txt or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <string>
+#include <vector>
+
+class cmExecutionStatus;
+
+/**
+ * \brief Create imported targets and set their properties in one call.
+ *
+ * cmCMakeImportTargetsCommand loads the compact description of imported
+ * targets written by cmExportFileGenerator when
+ * CMAKE_EXPORT_DECLARATIVE_TARGETS is enabled.
+ */
+bool cmCMakeImportTargetsCommand(std::vector<std::string> const& args,
+                                 cmExecutionStatus& status);
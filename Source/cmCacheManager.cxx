@@ -5,12 +5,17 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstring>
+#include <ios>
 #include <sstream>
 #include <string>
+#include <utility>
+
+#include <cm/string_view>
 
 #include "cmsys/FStream.hxx"
 #include "cmsys/Glob.hxx"
 
+#include "cmFileTime.h"
 #include "cmGeneratedFileStream.h"
 #include "cmList.h"
 #include "cmMessageType.h"
@@ -43,49 +48,58 @@ bool cmCacheManager::LoadCache(const std::string& path, bool internal,
     return false;
   }
 
-  cmsys::ifstream fin(cacheFile.c_str());
-  if (!fin) {
+  // Read the whole file at once and split it into lines in place.
+  std::string content;
+  cmFileTime contentTime;
+  if (!ReadCacheFile(cacheFile, content, contentTime)) {
     return false;
   }
-  const char* realbuffer;
-  std::string buffer;
-  std::string entryKey;
+  cm::string_view const text = content;
+  std::string::size_type pos = 0;
   unsigned int lineno = 0;
-  while (fin) {
-    // Format is key:type=value
-    std::string helpString;
-    CacheEntry e;
-    cmSystemTools::GetLineFromStream(fin, buffer);
-    lineno++;
-    realbuffer = buffer.c_str();
-    while (*realbuffer != '0' &&
-           (*realbuffer == ' ' || *realbuffer == '\t' || *realbuffer == '\r' ||
-            *realbuffer == '\n')) {
-      if (*realbuffer == '\n') {
-        lineno++;
-      }
-      realbuffer++;
+  auto getLine = [&text, &pos, &lineno](cm::string_view& line) -> bool {
+    if (pos >= text.size()) {
+      line = cm::string_view();
+      return false;
+    }
+    std::string::size_type eol = text.find('\n', pos);
+    if (eol == cm::string_view::npos) {
+      eol = text.size();
     }
+    line = text.substr(pos, eol - pos);
+    pos = eol + 1;
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    ++lineno;
+    return true;
+  };
+
+  std::string entry;
+  std::string entryKey;
+  cm::string_view line;
+  while (getLine(line)) {
+    // Format is key:type=value
+    std::string::size_type const first = line.find_first_not_of(" \t\r");
     // skip blank lines and comment lines
-    if (realbuffer[0] == '#' || realbuffer[0] == 0) {
+    if (first == cm::string_view::npos || line[first] == '#') {
       continue;
     }
-    while (realbuffer[0] == '/' && realbuffer[1] == '/') {
-      if ((realbuffer[2] == '\\') && (realbuffer[3] == 'n')) {
+    line = line.substr(first);
+    std::string helpString;
+    while (cmHasLiteralPrefix(line, "//")) {
+      if (cmHasLiteralPrefix(line.substr(2), "\\n")) {
         helpString += '\n';
-        helpString += &realbuffer[4];
+        helpString.append(line.data() + 4, line.size() - 4);
       } else {
-        helpString += &realbuffer[2];
-      }
-      cmSystemTools::GetLineFromStream(fin, buffer);
-      lineno++;
-      realbuffer = buffer.c_str();
-      if (!fin) {
-        continue;
+        helpString.append(line.data() + 2, line.size() - 2);
       }
+      getLine(line);
     }
+    CacheEntry e;
     e.SetProperty("HELPSTRING", helpString);
-    if (cmState::ParseCacheEntry(realbuffer, entryKey, e.Value, e.Type)) {
+    entry.assign(line.data(), line.size());
+    if (cmState::ParseCacheEntry(entry, entryKey, e.Value, e.Type)) {
       if (excludes.find(entryKey) == excludes.end()) {
         // Load internal values if internal is set.
         // If the entry is not internal to the cache being loaded
@@ -106,17 +120,26 @@ bool cmCacheManager::LoadCache(const std::string& path, bool internal,
           }
           if (!this->ReadPropertyEntry(entryKey, e)) {
             e.Initialized = true;
-            this->Cache[entryKey] = e;
+            this->Cache[entryKey] = std::move(e);
           }
         }
       }
     } else {
       std::ostringstream error;
       error << "Parse error in cache file " << cacheFile << " on line "
-            << lineno << ". Offending entry: " << realbuffer;
+            << lineno << ". Offending entry: " << entry;
       cmSystemTools::Error(error.str());
     }
   }
+
+  // Remember what our own cache file holds so that saving an unchanged
+  // cache does not rewrite it.
+  if (internal) {
+    this->SavedCacheFile = cacheFile;
+    this->SavedCacheContent = std::move(content);
+    this->SavedCacheTime = contentTime;
+  }
+
   this->CacheMajorVersion = 0;
   this->CacheMinorVersion = 0;
   if (cmValue cmajor =
@@ -167,6 +190,42 @@ bool cmCacheManager::LoadCache(const std::string& path, bool internal,
   return true;
 }
 
+bool cmCacheManager::ReadCacheFile(std::string const& cacheFile,
+                                   std::string& content, cmFileTime& time)
+{
+  if (!time.Load(cacheFile)) {
+    return false;
+  }
+  cmsys::ifstream fin(cacheFile.c_str(), std::ios::in | std::ios::binary);
+  if (!fin) {
+    return false;
+  }
+  fin.seekg(0, std::ios::end);
+  std::streamoff const size = fin.tellg();
+  fin.seekg(0, std::ios::beg);
+  if (size < 0) {
+    return false;
+  }
+  content.resize(static_cast<std::string::size_type>(size));
+  if (!content.empty() && !fin.read(&content[0], size)) {
+    return false;
+  }
+  return true;
+}
+
+bool cmCacheManager::IsSavedCacheCurrent(std::string const& cacheFile,
+                                         std::string const& content) const
+{
+  if (cacheFile != this->SavedCacheFile ||
+      content != this->SavedCacheContent) {
+    return false;
+  }
+  // The file must not have been touched since we read or wrote it.
+  cmFileTime time;
+  return time.Load(cacheFile) && time.Equal(this->SavedCacheTime) &&
+    cmSystemTools::FileLength(cacheFile) == content.size();
+}
+
 const char* cmCacheManager::PersistentProperties[] = { "ADVANCED", "MODIFIED",
                                                        "STRINGS" };
 
@@ -223,13 +282,6 @@ void cmCacheManager::WritePropertyEntries(std::ostream& os,
 bool cmCacheManager::SaveCache(const std::string& path, cmMessenger* messenger)
 {
   std::string cacheFile = cmStrCat(path, "/CMakeCache.txt");
-  cmGeneratedFileStream fout(cacheFile);
-  fout.SetCopyIfDifferent(true);
-  if (!fout) {
-    cmSystemTools::Error("Unable to open cache file for save. " + cacheFile);
-    cmSystemTools::ReportLastSystemError("");
-    return false;
-  }
   // before writing the cache, update the version numbers
   // to the
   this->AddCacheEntry("CMAKE_CACHE_MAJOR_VERSION",
@@ -262,6 +314,9 @@ bool cmCacheManager::SaveCache(const std::string& path, cmMessenger* messenger)
                       " was created",
                       cmStateEnums::INTERNAL);
 
+  // Format the cache in memory so it can be compared with the file.
+  std::ostringstream fout;
+
   /* clang-format off */
   fout << "# This is the CMakeCache file.\n"
           "# For build in directory: " << currentcwd << "\n"
@@ -339,7 +394,32 @@ bool cmCacheManager::SaveCache(const std::string& path, cmMessenger* messenger)
     }
   }
   fout << '\n';
-  fout.Close();
+
+  std::string content = fout.str();
+  if (!this->IsSavedCacheCurrent(cacheFile, content)) {
+    cmGeneratedFileStream cacheStream(cacheFile);
+    cacheStream.SetCopyIfDifferent(true);
+    if (!cacheStream) {
+      cmSystemTools::Error("Unable to open cache file for save. " +
+                           cacheFile);
+      cmSystemTools::ReportLastSystemError("");
+      return false;
+    }
+    cacheStream << content;
+    // Close() reports whether the file was replaced, which it is not when
+    // its content did not change, so check the stream for errors instead.
+    bool const written = !cacheStream.fail();
+    cacheStream.Close();
+    if (!written) {
+      this->SavedCacheFile.clear();
+      this->SavedCacheContent.clear();
+    } else {
+      this->SavedCacheFile = cacheFile;
+      this->SavedCacheContent = std::move(content);
+      this->SavedCacheTime.Load(cacheFile);
+    }
+  }
+
   std::string checkCacheFile = cmStrCat(path, "/CMakeFiles");
   cmSystemTools::MakeDirectory(checkCacheFile);
   checkCacheFile += "/cmake.check_cache";
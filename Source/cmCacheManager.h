@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "cmFileTime.h"
 #include "cmPropertyMap.h"
 #include "cmStateTypes.h"
 #include "cmValue.h"
@@ -213,6 +214,11 @@ private:
   static void OutputValueNoNewlines(std::ostream& fout,
                                     std::string const& value);
 
+  static bool ReadCacheFile(std::string const& cacheFile,
+                            std::string& content, cmFileTime& time);
+  bool IsSavedCacheCurrent(std::string const& cacheFile,
+                           std::string const& content) const;
+
   static const char* PersistentProperties[];
   bool ReadPropertyEntry(const std::string& key, const CacheEntry& e);
   void WritePropertyEntries(std::ostream& os, const std::string& entryKey,
@@ -221,6 +227,11 @@ private:
   std::map<std::string, CacheEntry> Cache;
   bool CacheLoaded = false;
 
+  // Content of the cache file as last read or written by us
+  std::string SavedCacheFile;
+  std::string SavedCacheContent;
+  cmFileTime SavedCacheTime;
+
   // Cache version info
   unsigned int CacheMajorVersion = 0;
   unsigned int CacheMinorVersion = 0;
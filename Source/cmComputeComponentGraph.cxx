@@ -50,7 +50,7 @@ void cmComputeComponentGraph::Tarjan()
   }
 }
 
-void cmComputeComponentGraph::TarjanVisit(size_t i)
+void cmComputeComponentGraph::TarjanEnter(size_t i)
 {
   // We are now visiting this node.
   this->TarjanVisited[i] = this->TarjanWalkId;
@@ -61,59 +61,79 @@ void cmComputeComponentGraph::TarjanVisit(size_t i)
   this->TarjanEntries[i].VisitIndex = ++this->TarjanIndex;
   this->TarjanStack.push(i);
 
-  // Follow outgoing edges.
-  EdgeList const& nl = this->InputGraph[i];
-  for (cmGraphEdge const& ni : nl) {
-    size_t j = ni;
-
-    // Ignore edges to nodes that have been reached by a previous DFS
-    // walk.  Since we did not reach the current node from that walk
-    // it must not belong to the same component and it has already
-    // been assigned to a component.
-    if (this->TarjanVisited[j] > 0 &&
-        this->TarjanVisited[j] < this->TarjanWalkId) {
-      continue;
-    }
+  // Start following its outgoing edges.
+  this->TarjanSteps.push_back({ i, 0 });
+}
 
-    // Visit the destination if it has not yet been visited.
-    if (!this->TarjanVisited[j]) {
-      this->TarjanVisit(j);
-    }
+void cmComputeComponentGraph::TarjanVisit(size_t root)
+{
+  // Walk depth first without recursion so that long dependency chains
+  // do not exhaust the stack.  Each step records a node and the number
+  // of its outgoing edges followed so far.
+  this->TarjanEnter(root);
+  while (!this->TarjanSteps.empty()) {
+    size_t const i = this->TarjanSteps.back().Node;
+
+    // Follow outgoing edges.
+    EdgeList const& nl = this->InputGraph[i];
+    if (this->TarjanSteps.back().Edge < nl.size()) {
+      size_t j = nl[this->TarjanSteps.back().Edge];
+
+      // Ignore edges to nodes that have been reached by a previous DFS
+      // walk.  Since we did not reach the current node from that walk
+      // it must not belong to the same component and it has already
+      // been assigned to a component.
+      if (this->TarjanVisited[j] > 0 &&
+          this->TarjanVisited[j] < this->TarjanWalkId) {
+        ++this->TarjanSteps.back().Edge;
+        continue;
+      }
 
-    // If the destination has not yet been assigned to a component,
-    // check if it has a better root for the current object.
-    if (this->TarjanComponents[j] == INVALID_COMPONENT) {
-      if (this->TarjanEntries[this->TarjanEntries[j].Root].VisitIndex <
-          this->TarjanEntries[this->TarjanEntries[i].Root].VisitIndex) {
-        this->TarjanEntries[i].Root = this->TarjanEntries[j].Root;
+      // Visit the destination if it has not yet been visited.  This
+      // edge is looked at again once the destination is done.
+      if (!this->TarjanVisited[j]) {
+        this->TarjanEnter(j);
+        continue;
       }
-    }
-  }
 
-  // Check if we have found a component.
-  if (this->TarjanEntries[i].Root == i) {
-    // Yes.  Create it.
-    size_t c = this->Components.size();
-    this->Components.emplace_back();
-    NodeList& component = this->Components[c];
-
-    // Populate the component list.
-    size_t j;
-    do {
-      // Get the next member of the component.
-      j = this->TarjanStack.top();
-      this->TarjanStack.pop();
-
-      // Assign the member to the component.
-      this->TarjanComponents[j] = c;
-      this->TarjanEntries[j].Root = i;
-
-      // Store the node in its component.
-      component.push_back(j);
-    } while (j != i);
-
-    // Sort the component members for clarity.
-    std::sort(component.begin(), component.end());
+      // If the destination has not yet been assigned to a component,
+      // check if it has a better root for the current object.
+      if (this->TarjanComponents[j] == INVALID_COMPONENT) {
+        if (this->TarjanEntries[this->TarjanEntries[j].Root].VisitIndex <
+            this->TarjanEntries[this->TarjanEntries[i].Root].VisitIndex) {
+          this->TarjanEntries[i].Root = this->TarjanEntries[j].Root;
+        }
+      }
+      ++this->TarjanSteps.back().Edge;
+      continue;
+    }
+    this->TarjanSteps.pop_back();
+
+    // Check if we have found a component.
+    if (this->TarjanEntries[i].Root == i) {
+      // Yes.  Create it.
+      size_t c = this->Components.size();
+      this->Components.emplace_back();
+      NodeList& component = this->Components[c];
+
+      // Populate the component list.
+      size_t j;
+      do {
+        // Get the next member of the component.
+        j = this->TarjanStack.top();
+        this->TarjanStack.pop();
+
+        // Assign the member to the component.
+        this->TarjanComponents[j] = c;
+        this->TarjanEntries[j].Root = i;
+
+        // Store the node in its component.
+        component.push_back(j);
+      } while (j != i);
+
+      // Sort the component members for clarity.
+      std::sort(component.begin(), component.end());
+    }
   }
 }
 
@@ -71,12 +71,19 @@ private:
   std::vector<size_t> TarjanVisited;
   std::vector<size_t> TarjanComponents;
   std::vector<TarjanEntry> TarjanEntries;
+  struct TarjanStep
+  {
+    size_t Node;
+    size_t Edge;
+  };
   std::vector<NodeList> Components;
   std::stack<size_t> TarjanStack;
+  std::vector<TarjanStep> TarjanSteps;
   size_t TarjanWalkId;
   size_t TarjanIndex;
   void Tarjan();
-  void TarjanVisit(size_t i);
+  void TarjanVisit(size_t root);
+  void TarjanEnter(size_t i);
 
   // Connected components.
 };
@@ -1346,6 +1346,16 @@ void cmComputeLinkDepends::UpdateGroupDependencies()
     return;
   }
 
+  // Map each raw item to the group it belongs to, if any.  When an item
+  // is listed in several groups the last one is used.
+  std::vector<size_t> itemGroups(this->EntryList.size(),
+                                 cmComputeComponentGraph::INVALID_COMPONENT);
+  for (const auto& groupItems : this->GroupItems) {
+    for (size_t item : groupItems.second) {
+      itemGroups[item] = groupItems.first;
+    }
+  }
+
   // Walks through all entries of the constraint graph to replace dependencies
   // over raw items by the group it belongs to, if any.
   for (auto& edgeList : this->EntryConstraintGraph) {
@@ -1356,15 +1366,10 @@ void cmComputeLinkDepends::UpdateGroupDependencies()
           this->EntryList[index].Kind == LinkEntry::Object) {
         continue;
       }
-      // search the item in the defined groups
-      for (const auto& groupItems : this->GroupItems) {
-        auto pos = std::find(groupItems.second.cbegin(),
-                             groupItems.second.cend(), index);
-        if (pos != groupItems.second.cend()) {
-          // replace lib dependency by the group it belongs to
-          edge = cmGraphEdge{ groupItems.first, false, false,
-                              cmListFileBacktrace() };
-        }
+      size_t group = itemGroups[index];
+      if (group != cmComputeComponentGraph::INVALID_COMPONENT) {
+        // replace lib dependency by the group it belongs to
+        edge = cmGraphEdge{ group, false, false, cmListFileBacktrace() };
       }
     }
   }
@@ -1535,16 +1540,32 @@ void cmComputeLinkDepends::VisitComponent(size_t c)
   // We are now visiting this component so mark it.
   this->ComponentVisited[c] = 1;
 
-  // Visit the neighbors of the component first.
-  // Run in reverse order so the topological order will preserve the
-  // original order where there are no constraints.
-  EdgeList const& nl = this->CCG->GetComponentGraphEdges(c);
-  for (cmGraphEdge const& edge : cmReverseRange(nl)) {
-    this->VisitComponent(edge);
-  }
+  // Walk the component graph depth first without recursion so that long
+  // dependency chains do not exhaust the stack.  Each step records the
+  // component and the number of its edges followed so far.
+  std::vector<std::pair<size_t, size_t>> steps;
+  steps.emplace_back(c, 0);
+  while (!steps.empty()) {
+    size_t const cur = steps.back().first;
+    EdgeList const& nl = this->CCG->GetComponentGraphEdges(cur);
+
+    // Visit the neighbors of the component first.
+    // Run in reverse order so the topological order will preserve the
+    // original order where there are no constraints.
+    if (steps.back().second < nl.size()) {
+      size_t const next = nl[nl.size() - 1 - steps.back().second];
+      ++steps.back().second;
+      if (!this->ComponentVisited[next]) {
+        this->ComponentVisited[next] = 1;
+        steps.emplace_back(next, 0);
+      }
+      continue;
+    }
 
-  // Assign an ordering id to this component.
-  this->ComponentOrder[c] = --this->ComponentOrderId;
+    // Assign an ordering id to this component.
+    this->ComponentOrder[cur] = --this->ComponentOrderId;
+    steps.pop_back();
+  }
 }
 
 void cmComputeLinkDepends::VisitEntry(size_t index)
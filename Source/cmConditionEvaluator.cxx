@@ -8,9 +8,11 @@
 #include <functional>
 #include <iterator>
 #include <list>
+#include <memory>
 #include <sstream>
 #include <utility>
 
+#include <cm/iterator>
 #include <cm/string_view>
 #include <cmext/algorithm>
 
@@ -65,6 +67,116 @@ auto const keyVERSION_LESS = "VERSION_LESS"_s;
 auto const keyVERSION_LESS_EQUAL = "VERSION_LESS_EQUAL"_s;
 auto const keyPATH_EQUAL = "PATH_EQUAL"_s;
 
+using Keyword = cmConditionEvaluator::Keyword;
+} // anonymous namespace
+
+enum class cmConditionEvaluator::Keyword : unsigned char
+{
+  None,
+  ParenL,
+  ParenR,
+  // predicates
+  Exists,
+  IsReadable,
+  IsWritable,
+  IsExecutable,
+  IsDirectory,
+  IsSymlink,
+  IsAbsolute,
+  Command,
+  Policy,
+  Target,
+  Defined,
+  Test,
+  // binary operators
+  Matches,
+  Less,
+  LessEqual,
+  Greater,
+  GreaterEqual,
+  Equal,
+  StrLess,
+  StrLessEqual,
+  StrGreater,
+  StrGreaterEqual,
+  StrEqual,
+  VersionLess,
+  VersionLessEqual,
+  VersionGreater,
+  VersionGreaterEqual,
+  VersionEqual,
+  IsNewerThan,
+  InList,
+  PathEqual,
+  // logical operators
+  Not,
+  And,
+  Or,
+};
+
+namespace {
+// Spelling of each Keyword, in the order of declaration.
+cm::static_string_view const KeywordSpellings[] = {
+  ""_s,
+  keyParenL,
+  keyParenR,
+  keyEXISTS,
+  keyIS_READABLE,
+  keyIS_WRITABLE,
+  keyIS_EXECUTABLE,
+  keyIS_DIRECTORY,
+  keyIS_SYMLINK,
+  keyIS_ABSOLUTE,
+  keyCOMMAND,
+  keyPOLICY,
+  keyTARGET,
+  keyDEFINED,
+  keyTEST,
+  keyMATCHES,
+  keyLESS,
+  keyLESS_EQUAL,
+  keyGREATER,
+  keyGREATER_EQUAL,
+  keyEQUAL,
+  keySTRLESS,
+  keySTRLESS_EQUAL,
+  keySTRGREATER,
+  keySTRGREATER_EQUAL,
+  keySTREQUAL,
+  keyVERSION_LESS,
+  keyVERSION_LESS_EQUAL,
+  keyVERSION_GREATER,
+  keyVERSION_GREATER_EQUAL,
+  keyVERSION_EQUAL,
+  keyIS_NEWER_THAN,
+  keyIN_LIST,
+  keyPATH_EQUAL,
+  keyNOT,
+  keyAND,
+  keyOR,
+};
+
+cm::static_string_view KeywordSpelling(Keyword keyword)
+{
+  return KeywordSpellings[static_cast<std::size_t>(keyword)];
+}
+
+bool IsPredicate(Keyword keyword)
+{
+  return keyword >= Keyword::Exists && keyword <= Keyword::Test;
+}
+
+bool IsBinaryOperator(Keyword keyword)
+{
+  return keyword >= Keyword::Matches && keyword <= Keyword::PathEqual;
+}
+
+// Position of a comparison within its group of five operators, 1-based.
+int ComparisonIndex(Keyword op, Keyword first)
+{
+  return static_cast<int>(op) - static_cast<int>(first) + 1;
+}
+
 cmSystemTools::CompareOp const MATCH2CMPOP[5] = {
   cmSystemTools::OP_LESS, cmSystemTools::OP_LESS_EQUAL,
   cmSystemTools::OP_GREATER, cmSystemTools::OP_GREATER_EQUAL,
@@ -215,6 +327,234 @@ public:
 
 // END cmConditionEvaluator::cmArgumentList
 
+// BEGIN cmCompiledCondition
+
+/**
+ * The operations that evaluate a condition, in the order in which the
+ * level-by-level reduction of cmConditionEvaluator::IsTrue performs them.
+ * That order depends only on which arguments are keywords, so it is worked
+ * out once for each shape of arguments and then replayed on the argument
+ * values of every evaluation.
+ */
+struct cmCompiledCondition
+{
+  enum class Kind : unsigned char
+  {
+    Group,      // Target = value of the steps up to Rhs
+    Predicate,  // Target = Op Lhs
+    False,      // Target = false
+    Binary,     // Target = Lhs Op Rhs
+    Not,        // Target = NOT Lhs
+    Logic,      // Target = Lhs AND|OR Rhs
+    Mismatched, // fail: mismatched parenthesis
+    Unknown,    // fail: unknown arguments
+    Result,     // value = Lhs
+  };
+
+  struct Step
+  {
+    Kind What;
+    Keyword Op;
+    std::size_t Target;
+    std::size_t Lhs;
+    std::size_t Rhs;
+  };
+
+  // Policies that decide whether a keyword is an operator at all.
+  struct Operators
+  {
+    bool Test;
+    bool InList;
+    bool PathEqual;
+  };
+
+  cmCompiledCondition(std::vector<Keyword> const& keywords,
+                      Operators operators);
+
+  std::vector<Step> Steps;
+
+private:
+  struct Item
+  {
+    Keyword Key;
+    std::size_t Slot;
+  };
+  using ItemList = std::list<Item>;
+
+  void Add(Kind what, Keyword op, std::size_t target, std::size_t lhs = 0,
+           std::size_t rhs = 0)
+  {
+    this->Steps.push_back(Step{ what, op, target, lhs, rhs });
+  }
+
+  ItemList::iterator Following(ItemList& items, ItemList::iterator i)
+  {
+    return i == items.end() ? i : std::next(i);
+  }
+
+  void Compile(ItemList& items);
+  bool CompileLevel0(ItemList& items);
+  bool CompileLevel1(ItemList& items);
+  bool CompileLevel2(ItemList& items);
+  bool CompileLevel3(ItemList& items);
+  bool CompileLevel4(ItemList& items);
+
+  Operators Enabled;
+};
+
+cmCompiledCondition::cmCompiledCondition(std::vector<Keyword> const& keywords,
+                                         Operators operators)
+  : Enabled(operators)
+{
+  ItemList items;
+  for (std::size_t i = 0; i < keywords.size(); ++i) {
+    items.push_back(Item{ keywords[i], i });
+  }
+  this->Compile(items);
+}
+
+// Mirrors cmConditionEvaluator::IsTrue.
+void cmCompiledCondition::Compile(ItemList& items)
+{
+  if (items.empty()) {
+    return;
+  }
+
+  using levelFn_t = bool (cmCompiledCondition::*)(ItemList&);
+  std::array<levelFn_t, 5> const levels = { {
+    &cmCompiledCondition::CompileLevel0, // parenthesis
+    &cmCompiledCondition::CompileLevel1, // predicates
+    &cmCompiledCondition::CompileLevel2, // binary ops
+    &cmCompiledCondition::CompileLevel3, // NOT
+    &cmCompiledCondition::CompileLevel4  // AND OR
+  } };
+  for (auto fn : levels) {
+    auto levelResult = true;
+    for (auto beginSize = items.size();
+         (levelResult = (this->*fn)(items)) && items.size() < beginSize;
+         beginSize = items.size()) {
+    }
+    if (!levelResult) {
+      return;
+    }
+  }
+
+  if (items.size() != 1) {
+    this->Add(Kind::Unknown, Keyword::None, 0);
+  } else {
+    this->Add(Kind::Result, Keyword::None, 0, items.front().Slot);
+  }
+}
+
+// Mirrors cmConditionEvaluator::HandleLevel0.
+bool cmCompiledCondition::CompileLevel0(ItemList& items)
+{
+  for (auto arg = items.begin(); arg != items.end(); ++arg) {
+    if (arg->Key == Keyword::ParenL) {
+      auto depth = 1;
+      auto argClose = std::next(arg);
+      for (; argClose != items.end() && depth; ++argClose) {
+        depth += int(argClose->Key == Keyword::ParenL) -
+          int(argClose->Key == Keyword::ParenR);
+      }
+      if (depth) {
+        this->Add(Kind::Mismatched, Keyword::None, 0);
+        return false;
+      }
+
+      ItemList subExpr(std::next(arg), std::prev(argClose));
+      std::size_t const group = this->Steps.size();
+      this->Add(Kind::Group, Keyword::None, arg->Slot);
+      this->Compile(subExpr);
+      this->Steps[group].Rhs = this->Steps.size();
+
+      arg->Key = Keyword::None;
+      items.erase(std::next(arg), argClose);
+    }
+  }
+  return true;
+}
+
+// Mirrors cmConditionEvaluator::HandleLevel1.
+bool cmCompiledCondition::CompileLevel1(ItemList& items)
+{
+  for (auto current = items.begin(); current != items.end(); ++current) {
+    auto next = this->Following(items, current);
+    if (next == items.end() || !IsPredicate(current->Key) ||
+        (current->Key == Keyword::Test && !this->Enabled.Test)) {
+      continue;
+    }
+    this->Add(Kind::Predicate, current->Key, current->Slot, next->Slot);
+    current->Key = Keyword::None;
+    items.erase(next);
+  }
+  return true;
+}
+
+// Mirrors cmConditionEvaluator::HandleLevel2.
+bool cmCompiledCondition::CompileLevel2(ItemList& items)
+{
+  for (auto current = items.begin(); current != items.end(); ++current) {
+    auto next = this->Following(items, current);
+    auto nextnext = this->Following(items, next);
+    if (next != items.end() && current->Key == Keyword::Matches) {
+      this->Add(Kind::False, Keyword::None, current->Slot);
+      current->Key = Keyword::None;
+      items.erase(next);
+      continue;
+    }
+    if (next == items.end() || nextnext == items.end() ||
+        !IsBinaryOperator(next->Key) ||
+        (next->Key == Keyword::InList && !this->Enabled.InList) ||
+        (next->Key == Keyword::PathEqual && !this->Enabled.PathEqual)) {
+      continue;
+    }
+    this->Add(Kind::Binary, next->Key, current->Slot, current->Slot,
+              nextnext->Slot);
+    current->Key = Keyword::None;
+    items.erase(nextnext);
+    items.erase(next);
+  }
+  return true;
+}
+
+// Mirrors cmConditionEvaluator::HandleLevel3.
+bool cmCompiledCondition::CompileLevel3(ItemList& items)
+{
+  for (auto current = items.begin();
+       this->Following(items, current) != items.end(); ++current) {
+    if (current->Key == Keyword::Not) {
+      auto next = std::next(current);
+      this->Add(Kind::Not, Keyword::Not, current->Slot, next->Slot);
+      current->Key = Keyword::None;
+      items.erase(next);
+    }
+  }
+  return true;
+}
+
+// Mirrors cmConditionEvaluator::HandleLevel4.
+bool cmCompiledCondition::CompileLevel4(ItemList& items)
+{
+  for (auto current = items.begin();
+       this->Following(items, this->Following(items, current)) !=
+       items.end();
+       ++current) {
+    auto next = std::next(current);
+    if (next->Key == Keyword::And || next->Key == Keyword::Or) {
+      auto nextnext = std::next(next);
+      this->Add(Kind::Logic, next->Key, current->Slot, current->Slot,
+                nextnext->Slot);
+      current->Key = Keyword::None;
+      items.erase(nextnext);
+      items.erase(next);
+    }
+  }
+  return true;
+}
+
+// END cmCompiledCondition
+
 cmConditionEvaluator::cmConditionEvaluator(cmMakefile& makefile,
                                            cmListFileBacktrace bt)
   : Makefile(makefile)
@@ -254,6 +594,14 @@ bool cmConditionEvaluator::IsTrue(
     return false;
   }
 
+  // replay the reduction worked out for arguments of this shape before
+  if (std::shared_ptr<cmCompiledCondition const> condition =
+        this->GetCompiledCondition(args)) {
+    std::vector<cmExpandedCommandArgument> values(args);
+    return this->ExecuteCompiled(*condition, 0, condition->Steps.size(),
+                                 values, errorString, status);
+  }
+
   // store the reduced args in this vector
   cmArgumentList newArgs(args.begin(), args.end());
 
@@ -296,6 +644,168 @@ bool cmConditionEvaluator::IsTrue(
                                                   status, true);
 }
 
+//=========================================================================
+std::shared_ptr<cmCompiledCondition const>
+cmConditionEvaluator::GetCompiledCondition(
+  const std::vector<cmExpandedCommandArgument>& args) const
+{
+  // Policy warnings are issued while keywords are recognized, so their
+  // order can only be kept by interpreting the condition.
+  if (this->Policy54Status == cmPolicies::WARN ||
+      this->Policy57Status == cmPolicies::WARN ||
+      this->Policy64Status == cmPolicies::WARN ||
+      this->Policy139Status == cmPolicies::WARN) {
+    return nullptr;
+  }
+
+  cmCompiledCondition::Operators const operators = {
+    this->Policy64Status != cmPolicies::OLD,
+    this->Policy57Status != cmPolicies::OLD,
+    this->Policy139Status != cmPolicies::OLD,
+  };
+
+  std::vector<Keyword> keywords;
+  keywords.reserve(args.size());
+  std::string shape;
+  shape.reserve(args.size() + 3);
+  for (cmExpandedCommandArgument const& arg : args) {
+    keywords.push_back(this->ClassifyKeyword(arg));
+    shape += static_cast<char>('A' + static_cast<int>(keywords.back()));
+  }
+  shape += operators.Test ? '1' : '0';
+  shape += operators.InList ? '1' : '0';
+  shape += operators.PathEqual ? '1' : '0';
+
+  cmake* cm = this->Makefile.GetCMakeInstance();
+  cmake::CompiledConditionMap& conditions = cm->GetCompiledConditions();
+  auto it = conditions.find(shape);
+  bool const hit = it != conditions.end();
+#ifndef CMAKE_BOOTSTRAP
+  if (cm->IsProfilingEnabled()) {
+    cm->GetProfilingOutput().IncrementCounter("condition_cache",
+                                              hit ? "hits" : "misses");
+  }
+#endif
+  if (hit) {
+    return it->second;
+  }
+
+  // Expansions of long lists give many shapes that are seen only once.
+  if (conditions.size() >= 4096) {
+    conditions.clear();
+  }
+  auto condition =
+    std::make_shared<cmCompiledCondition const>(keywords, operators);
+  conditions.emplace(std::move(shape), condition);
+  return condition;
+}
+
+//=========================================================================
+bool cmConditionEvaluator::ExecuteCompiled(
+  cmCompiledCondition const& condition, std::size_t begin, std::size_t end,
+  std::vector<cmExpandedCommandArgument>& values, std::string& errorString,
+  MessageType& status)
+{
+  using Kind = cmCompiledCondition::Kind;
+  for (std::size_t i = begin; i < end; ++i) {
+    cmCompiledCondition::Step const& step = condition.Steps[i];
+    switch (step.What) {
+      case Kind::Group: {
+        errorString.clear();
+        const auto value = this->ExecuteCompiled(condition, i + 1, step.Rhs,
+                                                 values, errorString, status);
+        values[step.Target] =
+          cmExpandedCommandArgument(bool2string(value), true);
+        i = step.Rhs - 1;
+      } break;
+      case Kind::Predicate:
+        values[step.Target] = cmExpandedCommandArgument(
+          bool2string(this->EvaluatePredicate(step.Op, values[step.Lhs])),
+          true);
+        break;
+      case Kind::False:
+        values[step.Target] =
+          cmExpandedCommandArgument(bool2string(false), true);
+        break;
+      case Kind::Binary: {
+        bool result = false;
+        if (!this->EvaluateBinary(step.Op, values[step.Lhs],
+                                  values[step.Rhs], errorString, status,
+                                  result)) {
+          return false;
+        }
+        values[step.Target] =
+          cmExpandedCommandArgument(bool2string(result), true);
+      } break;
+      case Kind::Not: {
+        const auto rhs = this->GetBooleanValueWithAutoDereference(
+          values[step.Lhs], errorString, status);
+        values[step.Target] =
+          cmExpandedCommandArgument(bool2string(!rhs), true);
+      } break;
+      case Kind::Logic: {
+        const auto lhs = this->GetBooleanValueWithAutoDereference(
+          values[step.Lhs], errorString, status);
+        const auto rhs = this->GetBooleanValueWithAutoDereference(
+          values[step.Rhs], errorString, status);
+        const auto result = step.Op == Keyword::And ? lhs && rhs : lhs || rhs;
+        values[step.Target] =
+          cmExpandedCommandArgument(bool2string(result), true);
+      } break;
+      case Kind::Mismatched:
+        errorString = "mismatched parenthesis in condition";
+        status = MessageType::FATAL_ERROR;
+        return false;
+      case Kind::Unknown:
+        errorString = "Unknown arguments specified";
+        status = MessageType::FATAL_ERROR;
+        return false;
+      case Kind::Result:
+        return this->GetBooleanValueWithAutoDereference(
+          values[step.Lhs], errorString, status, true);
+    }
+  }
+  return false;
+}
+
+//=========================================================================
+cmConditionEvaluator::Keyword cmConditionEvaluator::ClassifyKeyword(
+  const cmExpandedCommandArgument& argument) const
+{
+  if ((this->Policy54Status != cmPolicies::WARN &&
+       this->Policy54Status != cmPolicies::OLD) &&
+      argument.WasQuoted()) {
+    return Keyword::None;
+  }
+
+  std::string const& value = argument.GetValue();
+  if (value.empty() ||
+      !((value[0] >= 'A' && value[0] <= 'Z') || value[0] == '(' ||
+        value[0] == ')')) {
+    return Keyword::None;
+  }
+  for (std::size_t i = 1; i < cm::size(KeywordSpellings); ++i) {
+    if (value == KeywordSpellings[i]) {
+      return static_cast<Keyword>(i);
+    }
+  }
+  return Keyword::None;
+}
+
+//=========================================================================
+cmConditionEvaluator::Keyword cmConditionEvaluator::MatchKeyword(
+  const cmExpandedCommandArgument& argument, Keyword first,
+  Keyword last) const
+{
+  for (auto i = static_cast<int>(first); i <= static_cast<int>(last); ++i) {
+    auto const keyword = static_cast<Keyword>(i);
+    if (this->IsKeyword(KeywordSpelling(keyword), argument)) {
+      return keyword;
+    }
+  }
+  return Keyword::None;
+}
+
 //=========================================================================
 cmValue cmConditionEvaluator::GetDefinitionIfUnquoted(
   cmExpandedCommandArgument const& argument) const
@@ -495,6 +1005,173 @@ inline int cmConditionEvaluator::matchKeys(
   return matchKeysImpl<1>(arg, key...);
 }
 
+//=========================================================================
+bool cmConditionEvaluator::EvaluatePredicate(
+  Keyword keyword, const cmExpandedCommandArgument& arg) const
+{
+  std::string const& value = arg.GetValue();
+  switch (keyword) {
+    // does a file exist
+    case Keyword::Exists:
+      return cmSystemTools::FileExists(value);
+    // check if a file is readable
+    case Keyword::IsReadable:
+      return cmSystemTools::TestFileAccess(value, cmsys::TEST_FILE_READ);
+    // check if a file is writable
+    case Keyword::IsWritable:
+      return cmSystemTools::TestFileAccess(value, cmsys::TEST_FILE_WRITE);
+    // check if a file is executable
+    case Keyword::IsExecutable:
+      return cmSystemTools::TestFileAccess(value, cmsys::TEST_FILE_EXECUTE);
+    // does a directory with this name exist
+    case Keyword::IsDirectory:
+      return cmSystemTools::FileIsDirectory(value);
+    // does a symlink with this name exist
+    case Keyword::IsSymlink:
+      return cmSystemTools::FileIsSymlink(value);
+    // is the given path an absolute path ?
+    case Keyword::IsAbsolute:
+      return cmSystemTools::FileIsFullPath(value);
+    // does a command exist
+    case Keyword::Command:
+      return static_cast<bool>(this->Makefile.GetState()->GetCommand(value));
+    // does a policy exist
+    case Keyword::Policy: {
+      cmPolicies::PolicyID pid;
+      return cmPolicies::GetPolicyID(value.c_str(), pid);
+    }
+    // does a target exist
+    case Keyword::Target:
+      return static_cast<bool>(this->Makefile.FindTargetToUse(value));
+    // is a variable defined
+    case Keyword::Defined: {
+      const auto varNameLen = value.size();
+      if (looksLikeSpecialVariable(value, "ENV"_s, varNameLen)) {
+        const auto env = value.substr(4, varNameLen - 5);
+        return cmSystemTools::HasEnv(env);
+      }
+      if (looksLikeSpecialVariable(value, "CACHE"_s, varNameLen)) {
+        const auto cache = value.substr(6, varNameLen - 7);
+        return static_cast<bool>(
+          this->Makefile.GetState()->GetCacheEntryValue(cache));
+      }
+      return this->Makefile.IsDefinitionSet(value);
+    }
+    // does a test exist
+    case Keyword::Test:
+      return static_cast<bool>(this->Makefile.GetTest(value));
+    default:
+      return false;
+  }
+}
+
+//=========================================================================
+bool cmConditionEvaluator::EvaluateBinary(
+  Keyword op, const cmExpandedCommandArgument& lhsArg,
+  const cmExpandedCommandArgument& rhsArg, std::string& errorString,
+  MessageType& status, bool& result) const
+{
+  if (op == Keyword::Matches) {
+    cmValue def = this->GetDefinitionIfUnquoted(lhsArg);
+
+    std::string def_buf;
+    if (!def) {
+      def = cmValue(lhsArg.GetValue());
+    } else if (cmHasLiteralPrefix(lhsArg.GetValue(), "CMAKE_MATCH_")) {
+      // The string to match is owned by our match result variables.
+      // Move it to our own buffer before clearing them.
+      def_buf = *def;
+      def = cmValue(def_buf);
+    }
+
+    this->Makefile.ClearMatches();
+
+    const auto& rex = rhsArg.GetValue();
+    std::shared_ptr<cmsys::RegularExpression const> const regEntry =
+      this->Makefile.GetCMakeInstance()->GetCompiledRegularExpression(rex);
+    if (!regEntry->is_valid()) {
+      std::ostringstream error;
+      error << "Regular expression \"" << rex << "\" cannot compile";
+      errorString = error.str();
+      status = MessageType::FATAL_ERROR;
+      return false;
+    }
+
+    cmsys::RegularExpressionMatch regMatch;
+    result = regEntry->find(def->c_str(), regMatch);
+    if (result) {
+      this->Makefile.StoreMatches(regMatch);
+    }
+  }
+
+  else if (op >= Keyword::Less && op <= Keyword::Equal) {
+    cmValue ldef = this->GetVariableOrString(lhsArg);
+    cmValue rdef = this->GetVariableOrString(rhsArg);
+
+    double lhs;
+    double rhs;
+    auto parseDoubles = [&]() {
+      return std::sscanf(ldef->c_str(), "%lg", &lhs) == 1 &&
+        std::sscanf(rdef->c_str(), "%lg", &rhs) == 1;
+    };
+    // clang-format off
+    result = parseDoubles() &&
+      cmRt2CtSelector<
+          std::less, std::less_equal,
+          std::greater, std::greater_equal,
+          std::equal_to
+        >::eval(ComparisonIndex(op, Keyword::Less), lhs, rhs);
+    // clang-format on
+  }
+
+  else if (op >= Keyword::StrLess && op <= Keyword::StrEqual) {
+    const cmValue lhs = this->GetVariableOrString(lhsArg);
+    const cmValue rhs = this->GetVariableOrString(rhsArg);
+    const auto val = (*lhs).compare(*rhs);
+    // clang-format off
+    result = cmRt2CtSelector<
+          std::less, std::less_equal,
+          std::greater, std::greater_equal,
+          std::equal_to
+        >::eval(ComparisonIndex(op, Keyword::StrLess), val, 0);
+    // clang-format on
+  }
+
+  else if (op >= Keyword::VersionLess && op <= Keyword::VersionEqual) {
+    const auto cmpOp =
+      MATCH2CMPOP[ComparisonIndex(op, Keyword::VersionLess) - 1];
+    const cmValue lhs = this->GetVariableOrString(lhsArg);
+    const cmValue rhs = this->GetVariableOrString(rhsArg);
+    result = cmSystemTools::VersionCompare(cmpOp, lhs, rhs);
+  }
+
+  // is file A newer than file B
+  else if (op == Keyword::IsNewerThan) {
+    auto fileIsNewer = 0;
+    cmsys::Status ftcStatus = cmSystemTools::FileTimeCompare(
+      lhsArg.GetValue(), rhsArg.GetValue(), &fileIsNewer);
+    result = (!ftcStatus || fileIsNewer == 1 || fileIsNewer == 0);
+  }
+
+  else if (op == Keyword::InList) {
+    cmValue lhs = this->GetVariableOrString(lhsArg);
+    cmValue rhs = this->Makefile.GetDefinition(rhsArg.GetValue());
+    result = rhs &&
+      cm::contains(cmList{ *rhs, cmList::EmptyElements::Yes }, *lhs);
+  }
+
+  else if (op == Keyword::PathEqual) {
+    cmValue lhs = this->GetVariableOrString(lhsArg);
+    cmValue rhs = this->GetVariableOrString(rhsArg);
+    result = cmCMakePath{ *lhs } == cmCMakePath{ *rhs };
+  }
+
+  else {
+    result = false;
+  }
+  return true;
+}
+
 //=========================================================================
 // level 0 processes parenthetical expressions
 bool cmConditionEvaluator::HandleLevel0(cmArgumentList& newArgs,
@@ -566,95 +1243,17 @@ bool cmConditionEvaluator::HandleLevel1(cmArgumentList& newArgs, std::string&,
       continue;
     }
 
-    // does a file exist
-    if (this->IsKeyword(keyEXISTS, *args.current)) {
-      newArgs.ReduceOneArg(cmSystemTools::FileExists(args.next->GetValue()),
-                           args);
-    }
-    // check if a file is readable
-    else if (this->IsKeyword(keyIS_READABLE, *args.current)) {
-      newArgs.ReduceOneArg(cmSystemTools::TestFileAccess(
-                             args.next->GetValue(), cmsys::TEST_FILE_READ),
-                           args);
-    }
-    // check if a file is writable
-    else if (this->IsKeyword(keyIS_WRITABLE, *args.current)) {
-      newArgs.ReduceOneArg(cmSystemTools::TestFileAccess(
-                             args.next->GetValue(), cmsys::TEST_FILE_WRITE),
-                           args);
-    }
-    // check if a file is executable
-    else if (this->IsKeyword(keyIS_EXECUTABLE, *args.current)) {
-      newArgs.ReduceOneArg(cmSystemTools::TestFileAccess(
-                             args.next->GetValue(), cmsys::TEST_FILE_EXECUTE),
-                           args);
-    }
-    // does a directory with this name exist
-    else if (this->IsKeyword(keyIS_DIRECTORY, *args.current)) {
-      newArgs.ReduceOneArg(
-        cmSystemTools::FileIsDirectory(args.next->GetValue()), args);
-    }
-    // does a symlink with this name exist
-    else if (this->IsKeyword(keyIS_SYMLINK, *args.current)) {
-      newArgs.ReduceOneArg(cmSystemTools::FileIsSymlink(args.next->GetValue()),
-                           args);
-    }
-    // is the given path an absolute path ?
-    else if (this->IsKeyword(keyIS_ABSOLUTE, *args.current)) {
-      newArgs.ReduceOneArg(
-        cmSystemTools::FileIsFullPath(args.next->GetValue()), args);
-    }
-    // does a command exist
-    else if (this->IsKeyword(keyCOMMAND, *args.current)) {
-      newArgs.ReduceOneArg(
-        static_cast<bool>(
-          this->Makefile.GetState()->GetCommand(args.next->GetValue())),
-        args);
-    }
-    // does a policy exist
-    else if (this->IsKeyword(keyPOLICY, *args.current)) {
-      cmPolicies::PolicyID pid;
-      newArgs.ReduceOneArg(
-        cmPolicies::GetPolicyID(args.next->GetValue().c_str(), pid), args);
-    }
-    // does a target exist
-    else if (this->IsKeyword(keyTARGET, *args.current)) {
-      newArgs.ReduceOneArg(static_cast<bool>(this->Makefile.FindTargetToUse(
-                             args.next->GetValue())),
-                           args);
-    }
-    // is a variable defined
-    else if (this->IsKeyword(keyDEFINED, *args.current)) {
-      const auto& var = args.next->GetValue();
-      const auto varNameLen = var.size();
-
-      auto result = false;
-      if (looksLikeSpecialVariable(var, "ENV"_s, varNameLen)) {
-        const auto env = args.next->GetValue().substr(4, varNameLen - 5);
-        result = cmSystemTools::HasEnv(env);
-      }
-
-      else if (looksLikeSpecialVariable(var, "CACHE"_s, varNameLen)) {
-        const auto cache = args.next->GetValue().substr(6, varNameLen - 7);
-        result = static_cast<bool>(
-          this->Makefile.GetState()->GetCacheEntryValue(cache));
-      }
-
-      else {
-        result = this->Makefile.IsDefinitionSet(args.next->GetValue());
-      }
-      newArgs.ReduceOneArg(result, args);
+    Keyword const keyword =
+      this->MatchKeyword(*args.current, Keyword::Exists, Keyword::Test);
+    if (keyword == Keyword::None) {
+      continue;
     }
-    // does a test exist
-    else if (this->IsKeyword(keyTEST, *args.current)) {
-      if (this->Policy64Status == cmPolicies::OLD ||
-          this->Policy64Status == cmPolicies::WARN) {
-        continue;
-      }
-      newArgs.ReduceOneArg(
-        static_cast<bool>(this->Makefile.GetTest(args.next->GetValue())),
-        args);
+    if (keyword == Keyword::Test &&
+        (this->Policy64Status == cmPolicies::OLD ||
+         this->Policy64Status == cmPolicies::WARN)) {
+      continue;
     }
+    newArgs.ReduceOneArg(this->EvaluatePredicate(keyword, *args.next), args);
   }
   return true;
 }
@@ -668,7 +1267,7 @@ bool cmConditionEvaluator::HandleLevel2(cmArgumentList& newArgs,
   for (auto args = newArgs.make3ArgsIterator(); args.current != newArgs.end();
        args.advance(newArgs)) {
 
-    int matchNo;
+    Keyword keyword;
 
     // NOTE Handle special case `if(... BLAH_BLAH MATCHES)`
     // (i.e., w/o regex to match which is possibly result of
@@ -683,115 +1282,16 @@ bool cmConditionEvaluator::HandleLevel2(cmArgumentList& newArgs,
       continue;
     }
 
-    else if (this->IsKeyword(keyMATCHES, *args.next)) {
-      cmValue def = this->GetDefinitionIfUnquoted(*args.current);
-
-      std::string def_buf;
-      if (!def) {
-        def = cmValue(args.current->GetValue());
-      } else if (cmHasLiteralPrefix(args.current->GetValue(),
-                                    "CMAKE_MATCH_")) {
-        // The string to match is owned by our match result variables.
-        // Move it to our own buffer before clearing them.
-        def_buf = *def;
-        def = cmValue(def_buf);
-      }
-
-      this->Makefile.ClearMatches();
-
-      const auto& rex = args.nextnext->GetValue();
-      cmsys::RegularExpression regEntry;
-      if (!regEntry.compile(rex)) {
-        std::ostringstream error;
-        error << "Regular expression \"" << rex << "\" cannot compile";
-        errorString = error.str();
-        status = MessageType::FATAL_ERROR;
-        return false;
-      }
-
-      const auto match = regEntry.find(*def);
-      if (match) {
-        this->Makefile.StoreMatches(regEntry);
-      }
-      newArgs.ReduceTwoArgs(match, args);
-    }
-
-    else if ((matchNo =
-                this->matchKeys(*args.next, keyLESS, keyLESS_EQUAL, keyGREATER,
-                                keyGREATER_EQUAL, keyEQUAL))) {
-
-      cmValue ldef = this->GetVariableOrString(*args.current);
-      cmValue rdef = this->GetVariableOrString(*args.nextnext);
-
-      double lhs;
-      double rhs;
-      auto parseDoubles = [&]() {
-        return std::sscanf(ldef->c_str(), "%lg", &lhs) == 1 &&
-          std::sscanf(rdef->c_str(), "%lg", &rhs) == 1;
-      };
-      // clang-format off
-      const auto result = parseDoubles() &&
-        cmRt2CtSelector<
-            std::less, std::less_equal,
-            std::greater, std::greater_equal,
-            std::equal_to
-          >::eval(matchNo, lhs, rhs);
-      // clang-format on
-      newArgs.ReduceTwoArgs(result, args);
-    }
-
-    else if ((matchNo = this->matchKeys(*args.next, keySTRLESS,
-                                        keySTRLESS_EQUAL, keySTRGREATER,
-                                        keySTRGREATER_EQUAL, keySTREQUAL))) {
-
-      const cmValue lhs = this->GetVariableOrString(*args.current);
-      const cmValue rhs = this->GetVariableOrString(*args.nextnext);
-      const auto val = (*lhs).compare(*rhs);
-      // clang-format off
-      const auto result = cmRt2CtSelector<
-            std::less, std::less_equal,
-            std::greater, std::greater_equal,
-            std::equal_to
-          >::eval(matchNo, val, 0);
-      // clang-format on
-      newArgs.ReduceTwoArgs(result, args);
-    }
-
-    else if ((matchNo =
-                this->matchKeys(*args.next, keyVERSION_LESS,
-                                keyVERSION_LESS_EQUAL, keyVERSION_GREATER,
-                                keyVERSION_GREATER_EQUAL, keyVERSION_EQUAL))) {
-      const auto op = MATCH2CMPOP[matchNo - 1];
-      const cmValue lhs = this->GetVariableOrString(*args.current);
-      const cmValue rhs = this->GetVariableOrString(*args.nextnext);
-      const auto result = cmSystemTools::VersionCompare(op, lhs, rhs);
-      newArgs.ReduceTwoArgs(result, args);
-    }
-
-    // is file A newer than file B
-    else if (this->IsKeyword(keyIS_NEWER_THAN, *args.next)) {
-      auto fileIsNewer = 0;
-      cmsys::Status ftcStatus = cmSystemTools::FileTimeCompare(
-        args.current->GetValue(), args.nextnext->GetValue(), &fileIsNewer);
-      newArgs.ReduceTwoArgs(
-        (!ftcStatus || fileIsNewer == 1 || fileIsNewer == 0), args);
+    else if ((keyword = this->MatchKeyword(*args.next, Keyword::Matches,
+                                           Keyword::PathEqual)) ==
+             Keyword::None) {
+      continue;
     }
 
-    else if (this->IsKeyword(keyIN_LIST, *args.next)) {
-
-      if (this->Policy57Status != cmPolicies::OLD &&
-          this->Policy57Status != cmPolicies::WARN) {
-
-        cmValue lhs = this->GetVariableOrString(*args.current);
-        cmValue rhs = this->Makefile.GetDefinition(args.nextnext->GetValue());
-
-        newArgs.ReduceTwoArgs(
-          rhs &&
-            cm::contains(cmList{ *rhs, cmList::EmptyElements::Yes }, *lhs),
-          args);
-      }
-
-      else if (this->Policy57Status == cmPolicies::WARN) {
+    else if (keyword == Keyword::InList &&
+             (this->Policy57Status == cmPolicies::OLD ||
+              this->Policy57Status == cmPolicies::WARN)) {
+      if (this->Policy57Status == cmPolicies::WARN) {
         std::ostringstream e;
         e << cmPolicies::GetPolicyWarning(cmPolicies::CMP0057)
           << "\n"
@@ -803,18 +1303,10 @@ bool cmConditionEvaluator::HandleLevel2(cmArgumentList& newArgs,
       }
     }
 
-    else if (this->IsKeyword(keyPATH_EQUAL, *args.next)) {
-
-      if (this->Policy139Status != cmPolicies::OLD &&
-          this->Policy139Status != cmPolicies::WARN) {
-
-        cmValue lhs = this->GetVariableOrString(*args.current);
-        cmValue rhs = this->GetVariableOrString(*args.nextnext);
-        const auto result = cmCMakePath{ *lhs } == cmCMakePath{ *rhs };
-        newArgs.ReduceTwoArgs(result, args);
-      }
-
-      else if (this->Policy139Status == cmPolicies::WARN) {
+    else if (keyword == Keyword::PathEqual &&
+             (this->Policy139Status == cmPolicies::OLD ||
+              this->Policy139Status == cmPolicies::WARN)) {
+      if (this->Policy139Status == cmPolicies::WARN) {
         std::ostringstream e;
         e << cmPolicies::GetPolicyWarning(cmPolicies::CMP0139)
           << "\n"
@@ -825,6 +1317,15 @@ bool cmConditionEvaluator::HandleLevel2(cmArgumentList& newArgs,
         this->Makefile.IssueMessage(MessageType::AUTHOR_WARNING, e.str());
       }
     }
+
+    else {
+      bool result = false;
+      if (!this->EvaluateBinary(keyword, *args.current, *args.nextnext,
+                                errorString, status, result)) {
+        return false;
+      }
+      newArgs.ReduceTwoArgs(result, args);
+    }
   }
   return true;
 }
@@ -4,6 +4,8 @@
 
 #include "cmConfigure.h" // IWYU pragma: keep
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -16,6 +18,7 @@
 
 class cmExpandedCommandArgument;
 class cmMakefile;
+struct cmCompiledCondition;
 
 class cmConditionEvaluator
 {
@@ -28,9 +31,35 @@ public:
   bool IsTrue(const std::vector<cmExpandedCommandArgument>& args,
               std::string& errorString, MessageType& status);
 
+  // Keywords of the condition syntax.  Defined with the implementation.
+  enum class Keyword : unsigned char;
+
 private:
   class cmArgumentList;
 
+  // Get the operations that evaluate conditions shaped like the given
+  // arguments, or nullptr if they must be interpreted step by step.
+  std::shared_ptr<cmCompiledCondition const> GetCompiledCondition(
+    const std::vector<cmExpandedCommandArgument>& args) const;
+
+  bool ExecuteCompiled(cmCompiledCondition const& condition, std::size_t begin,
+                       std::size_t end,
+                       std::vector<cmExpandedCommandArgument>& values,
+                       std::string& errorString, MessageType& status);
+
+  Keyword ClassifyKeyword(const cmExpandedCommandArgument& argument) const;
+
+  Keyword MatchKeyword(const cmExpandedCommandArgument& argument,
+                       Keyword first, Keyword last) const;
+
+  bool EvaluatePredicate(Keyword predicate,
+                         const cmExpandedCommandArgument& arg) const;
+
+  bool EvaluateBinary(Keyword op, const cmExpandedCommandArgument& lhsArg,
+                      const cmExpandedCommandArgument& rhsArg,
+                      std::string& errorString, MessageType& status,
+                      bool& result) const;
+
   // Filter the given variable definition based on policy CMP0054.
   cmValue GetDefinitionIfUnquoted(
     const cmExpandedCommandArgument& argument) const;
@@ -2,11 +2,16 @@
    file Copyright.txt or https://cmake.org/licensing for details.  */
 #include "cmCoreTryCompile.h"
 
+#include <algorithm>
 #include <array>
+#include <climits>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <iterator>
 #include <set>
 #include <sstream>
+#include <thread>
 #include <utility>
 
 #include <cm/string_view>
@@ -18,11 +23,15 @@
 
 #include "cmArgumentParser.h"
 #include "cmConfigureLog.h"
+#include "cmCryptoHash.h"
 #include "cmExperimental.h"
 #include "cmExportTryCompileFileGenerator.h"
 #include "cmGlobalGenerator.h"
 #include "cmList.h"
 #include "cmMakefile.h"
+#ifndef CMAKE_BOOTSTRAP
+#  include "cmMakefileProfilingData.h"
+#endif
 #include "cmMessageType.h"
 #include "cmOutputConverter.h"
 #include "cmPolicies.h"
@@ -211,7 +220,9 @@ auto const TryCompileProjectArgParser =
   makeTryCompileParser(TryCompileBaseProjectArgParser);
 
 auto const TryCompileSourcesArgParser =
-  makeTryCompileParser(TryCompileBaseNewSourcesArgParser);
+  makeTryCompileParser(TryCompileBaseNewSourcesArgParser)
+    .Bind("PROBE"_s, &Arguments::Probes)
+  /* keep semicolon on own line */;
 
 auto const TryCompileOldArgParser =
   makeTryCompileParser(TryCompileBaseSourcesArgParser)
@@ -287,7 +298,8 @@ Arguments cmCoreTryCompile::ParseArgs(
     return arguments;
   }
 
-  if (cmHasLiteralPrefix(second, "SOURCE")) {
+  if (cmHasLiteralPrefix(second, "SOURCE") ||
+      (!isTryRun && second == "PROBE")) {
     // New SOURCES signature.
     auto arguments = this->ParseArgs(
       args, isTryRun ? TryRunSourcesArgParser : TryCompileSourcesArgParser,
@@ -329,6 +341,290 @@ Arguments cmCoreTryCompile::ParseArgs(
   return arguments;
 }
 
+namespace {
+/* Return the name of the file, relative to the try_compile binary
+   directory, in which the inner project records its output location.  */
+std::string OutputFileLocationName(cmMakefile* mf,
+                                   std::string const& targetName)
+{
+  std::string name = cmStrCat('/', targetName);
+  if (mf->GetGlobalGenerator()->IsMultiConfig()) {
+    std::string const tcConfig =
+      mf->GetSafeDefinition("CMAKE_TRY_COMPILE_CONFIGURATION");
+    std::string const cfg = !tcConfig.empty()
+      ? cmSystemTools::UpperCase(tcConfig)
+      : TryCompileDefaultConfig;
+    name = cmStrCat(name, '_', cfg);
+  }
+  name += "_loc";
+  return name;
+}
+
+/* Return the parallel level at which to build the probes.  The default
+   level lets some native tools, such as make, start one compiler per
+   probe without any limit.  */
+int ProbeBuildParallelLevel()
+{
+  std::string parallel;
+  unsigned long level = 0;
+  if (cmSystemTools::GetEnv("CMAKE_BUILD_PARALLEL_LEVEL", parallel) &&
+      cmStrToULong(parallel, &level) && level > 0 && level <= INT_MAX) {
+    return static_cast<int>(level);
+  }
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+/* The try_compile result cache stores the outcome of source file
+   try_compile calls under a name derived from a hash of everything the
+   inner project is generated from: its binary directory content, the
+   sources, the cache entries passed to it and the identity of the
+   toolchain and the environment variables that the compiler reads.
+   The try_compile binary directory and the random target name are
+   replaced by placeholders.  Inputs that refer to other paths of the
+   build tree, such as include directories of generated headers, also
+   hash the real build tree path, so only probes independent of the
+   build tree are shared by multiple build trees.  */
+char const TryCompileCacheMagic[] = "cmake-try-compile-cache-1";
+
+class TryCompileResultCache
+{
+public:
+  TryCompileResultCache(cmMakefile* mf, std::string binaryDirectory,
+                        std::string targetName)
+    : Makefile(mf)
+    , BinaryDirectory(std::move(binaryDirectory))
+    , TargetName(std::move(targetName))
+  {
+    std::string dir;
+    if (cmSystemTools::GetEnv("CMAKE_TRY_COMPILE_CACHE_DIR", dir) &&
+        !dir.empty()) {
+      this->Directory = cmSystemTools::CollapseFullPath(dir);
+    }
+  }
+
+  bool IsEnabled() const { return !this->Directory.empty(); }
+
+  void ComputeKey(std::vector<std::string> const& sources,
+                  std::vector<std::string> const& cmakeFlags)
+  {
+    cmCryptoHash hasher(cmCryptoHash::AlgoSHA256);
+    hasher.Initialize();
+    auto append = [&hasher](cm::string_view value) {
+      std::uint64_t const size = value.size();
+      hasher.Append(&size, sizeof(size));
+      hasher.Append(value);
+    };
+    bool referencesHome = false;
+    auto normalize = [this, &referencesHome](std::string value) {
+      value = this->Normalize(std::move(value));
+      if (value.find(HomeDirectoryPlaceholder) != std::string::npos) {
+        referencesHome = true;
+      }
+      return value;
+    };
+    auto appendFile = [&append, &normalize](std::string const& path) {
+      std::string content;
+      if (!cmSystemTools::ReadWholeFile(path, content)) {
+        return false;
+      }
+      append(normalize(std::move(content)));
+      return true;
+    };
+
+    append(TryCompileCacheMagic);
+    append(cmVersion::GetCMakeVersion());
+    cmGlobalGenerator* gg = this->Makefile->GetGlobalGenerator();
+    append(gg->GetName());
+    for (char const* var :
+         { "CMAKE_GENERATOR_PLATFORM", "CMAKE_GENERATOR_TOOLSET",
+           "CMAKE_TRY_COMPILE_CONFIGURATION" }) {
+      append(this->Makefile->GetSafeDefinition(var));
+    }
+
+    // The compiler information the inner project loads for each language.
+    std::string const platformInfoDir =
+      this->Makefile->GetSafeDefinition("CMAKE_PLATFORM_INFO_DIR");
+    std::vector<std::string> langs;
+    gg->GetEnabledLanguages(langs);
+    for (std::string const& lang : langs) {
+      append(lang);
+      appendFile(cmStrCat(platformInfoDir, "/CMake", lang, "Compiler.cmake"));
+      std::string const compiler = this->Makefile->GetSafeDefinition(
+        cmStrCat("CMAKE_", lang, "_COMPILER"));
+      append(compiler);
+      append(std::to_string(cmSystemTools::FileLength(compiler)));
+      append(std::to_string(cmSystemTools::ModifiedTime(compiler)));
+    }
+
+    // The environment that compilers and linkers read search paths and
+    // target platform settings from.
+    for (char const* var :
+         { "CPATH", "C_INCLUDE_PATH", "CPLUS_INCLUDE_PATH",
+           "OBJC_INCLUDE_PATH", "LIBRARY_PATH", "COMPILER_PATH",
+           "GCC_EXEC_PREFIX", "INCLUDE", "LIB", "LIBPATH", "CL", "_CL_",
+           "LINK", "_LINK_", "SDKROOT", "DEVELOPER_DIR",
+           "MACOSX_DEPLOYMENT_TARGET" }) {
+      std::string value;
+      if (cmSystemTools::GetEnv(var, value)) {
+        append(var);
+        append(value);
+      }
+    }
+
+    // The generated project and the sources it compiles.
+    cmsys::Directory dir;
+    dir.Load(this->BinaryDirectory);
+    std::vector<std::string> files;
+    for (unsigned long i = 0; i < dir.GetNumberOfFiles(); ++i) {
+      std::string const path =
+        cmStrCat(this->BinaryDirectory, '/', dir.GetFile(i));
+      if (!cmSystemTools::FileIsDirectory(path)) {
+        files.emplace_back(dir.GetFile(i));
+      }
+    }
+    std::sort(files.begin(), files.end());
+    for (std::string const& file : files) {
+      append(normalize(file));
+      if (!appendFile(cmStrCat(this->BinaryDirectory, '/', file))) {
+        return;
+      }
+    }
+    for (std::string const& source : sources) {
+      append(normalize(source));
+      if (!appendFile(source)) {
+        return;
+      }
+    }
+    for (std::string const& flag : cmakeFlags) {
+      append(normalize(flag));
+    }
+
+    // Files of this build tree may differ from those of the same name in
+    // another one, so results that depend on them are not shared.
+    if (referencesHome) {
+      append(this->Makefile->GetHomeOutputDirectory());
+    }
+
+    this->Entry = cmStrCat(this->Directory, '/', hasher.FinalizeHex());
+  }
+
+  bool Load(int& res, std::string& output) const
+  {
+    if (this->Entry.empty()) {
+      return false;
+    }
+    std::string data;
+    if (!cmSystemTools::ReadWholeFile(cmStrCat(this->Entry, ".txt"), data)) {
+      return false;
+    }
+    std::istringstream in(data);
+    std::string magic;
+    std::string exitCode;
+    std::string artifact;
+    if (!cmSystemTools::GetLineFromStream(in, magic) ||
+        magic != TryCompileCacheMagic ||
+        !cmSystemTools::GetLineFromStream(in, exitCode) ||
+        !cmSystemTools::GetLineFromStream(in, artifact)) {
+      return false;
+    }
+    long value;
+    if (!cmStrToLong(exitCode, &value)) {
+      return false;
+    }
+
+    if (!artifact.empty()) {
+      std::string const location =
+        cmStrCat(this->BinaryDirectory, '/', this->Restore(artifact));
+      if (!cmSystemTools::CopyFileAlways(cmStrCat(this->Entry, ".bin"),
+                                         location)) {
+        return false;
+      }
+      cmsys::ofstream fout(
+        cmStrCat(this->BinaryDirectory,
+                 OutputFileLocationName(this->Makefile, this->TargetName))
+          .c_str());
+      fout << location << '\n';
+      if (!fout) {
+        return false;
+      }
+    }
+
+    res = static_cast<int>(value);
+    output = this->Restore(
+      data.substr(static_cast<std::size_t>(in.tellg()), std::string::npos));
+    return true;
+  }
+
+  void Store(int res, std::string const& output,
+             std::string const& artifact) const
+  {
+    if (this->Entry.empty()) {
+      return;
+    }
+    cmSystemTools::MakeDirectory(this->Directory);
+
+    // Write the artifact first so that a result naming it is never
+    // observed without it.
+    std::string artifactName;
+    if (!artifact.empty()) {
+      // Copy the file so that its permissions are preserved.
+      std::string const bin = cmStrCat(this->Entry, ".bin");
+      std::string const tmp =
+        cmStrCat(bin, '.', cmSystemTools::RandomSeed(), ".tmp");
+      if (!cmSystemTools::CopyFileAlways(artifact, tmp)) {
+        cmSystemTools::RemoveFile(tmp);
+        return;
+      }
+      if (!cmSystemTools::RenameFile(tmp, bin)) {
+        cmSystemTools::RemoveFile(tmp);
+        return;
+      }
+      artifactName =
+        this->Normalize(cmSystemTools::GetFilenameName(artifact));
+    }
+    cmSystemTools::WriteFileAtomically(
+      cmStrCat(this->Entry, ".txt"),
+      cmStrCat(TryCompileCacheMagic, '\n', res, '\n', artifactName, '\n',
+               this->Normalize(output)));
+  }
+
+private:
+  std::string Normalize(std::string value) const
+  {
+    cmSystemTools::ReplaceString(value, this->BinaryDirectory,
+                                 BinaryDirectoryPlaceholder);
+    cmSystemTools::ReplaceString(value,
+                                 this->Makefile->GetHomeOutputDirectory(),
+                                 HomeDirectoryPlaceholder);
+    cmSystemTools::ReplaceString(value, this->TargetName, TargetPlaceholder);
+    return value;
+  }
+
+  std::string Restore(std::string value) const
+  {
+    cmSystemTools::ReplaceString(value, TargetPlaceholder, this->TargetName);
+    cmSystemTools::ReplaceString(value, HomeDirectoryPlaceholder,
+                                 this->Makefile->GetHomeOutputDirectory());
+    cmSystemTools::ReplaceString(value, BinaryDirectoryPlaceholder,
+                                 this->BinaryDirectory);
+    return value;
+  }
+
+  static constexpr char const* BinaryDirectoryPlaceholder =
+    "<CMAKE_TRY_COMPILE_BINARY_DIR>";
+  static constexpr char const* HomeDirectoryPlaceholder =
+    "<CMAKE_BINARY_DIR>";
+  static constexpr char const* TargetPlaceholder =
+    "<CMAKE_TRY_COMPILE_TARGET>";
+
+  cmMakefile* Makefile;
+  std::string BinaryDirectory;
+  std::string TargetName;
+  std::string Directory;
+  std::string Entry;
+};
+}
+
 cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
   Arguments& arguments, cmStateEnums::TargetType targetType)
 {
@@ -467,6 +763,50 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
         "SOURCE_FROM_FILE requires exactly two arguments");
       return cm::nullopt;
     }
+    for (std::vector<std::string> const& probe : arguments.Probes) {
+      if (probe.size() != 3) {
+        this->Makefile->IssueMessage(
+          MessageType::FATAL_ERROR,
+          "PROBE requires exactly three arguments: <resultVar> <name> "
+          "<content>");
+        return cm::nullopt;
+      }
+    }
+    if (!arguments.Probes.empty()) {
+      // Each probe writes its own source file, so its name must not
+      // replace another probe's source or one of the common sources.
+      std::set<std::string> sourceNames;
+      for (auto const* from :
+           { &arguments.SourceFromContent, &arguments.SourceFromVar,
+             &arguments.SourceFromFile }) {
+        if (*from) {
+          for (std::size_t i = 0; i < (*from)->size(); i += 2) {
+            sourceNames.insert((**from)[i].first);
+          }
+        }
+      }
+      std::set<std::string> probeNames;
+      for (std::vector<std::string> const& probe : arguments.Probes) {
+        if (!probeNames.insert(probe[1]).second) {
+          this->Makefile->IssueMessage(
+            MessageType::FATAL_ERROR,
+            cmStrCat("PROBE given repeated name \"", probe[1], '"'));
+          return cm::nullopt;
+        }
+        if (sourceNames.count(probe[1])) {
+          this->Makefile->IssueMessage(
+            MessageType::FATAL_ERROR,
+            cmStrCat("PROBE given name \"", probe[1],
+                     "\" that is also the name of a source file"));
+          return cm::nullopt;
+        }
+      }
+    }
+    if (!arguments.Probes.empty() && arguments.CopyFileTo) {
+      this->Makefile->IssueMessage(MessageType::FATAL_ERROR,
+                                   "COPY_FILE may not be used with PROBE");
+      return cm::nullopt;
+    }
     if (!arguments.SourceTypeError.empty()) {
       this->Makefile->IssueMessage(MessageType::FATAL_ERROR,
                                    arguments.SourceTypeError);
@@ -515,6 +855,8 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
   }
 
   std::map<std::string, std::string> cmakeVariables;
+  std::vector<std::string> sourceFiles;
+  std::vector<std::pair<std::string, std::string>> probeTargets;
 
   std::string outFileName = cmStrCat(this->BinaryDirectory, "/CMakeLists.txt");
   // which signature are we using? If we are using var srcfile bindir
@@ -584,13 +926,26 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
                              (*arguments.SourceFromFile)[i + 0].second);
       }
     }
+    for (std::vector<std::string> const& probe : arguments.Probes) {
+      auto out = this->WriteSource(probe[1], probe[2], "PROBE");
+      if (out.empty()) {
+        return cm::nullopt;
+      }
+      probeTargets.emplace_back(
+        cmStrCat(targetName, '_', probeTargets.size()), std::move(out));
+    }
     // TODO: ensure sources is not empty
+    for (auto const& source : sources) {
+      sourceFiles.emplace_back(source.first);
+    }
+    for (auto const& probe : probeTargets) {
+      sourceFiles.emplace_back(probe.second);
+    }
 
     // Detect languages to enable.
     cmGlobalGenerator* gg = this->Makefile->GetGlobalGenerator();
     std::set<std::string> testLangs;
-    for (auto const& source : sources) {
-      auto const& si = source.first;
+    for (std::string const& si : sourceFiles) {
       std::string ext = cmSystemTools::GetFilenameLastExtension(si);
       std::string lang = gg->GetLanguageFromExtension(ext.c_str());
       if (!lang.empty()) {
@@ -916,67 +1271,6 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
             "include(\"${CMAKE_ROOT}/Modules/Internal/"
             "HeaderpadWorkaround.cmake\")\n");
 
-    if (targetType == cmStateEnums::EXECUTABLE) {
-      /* Put the executable at a known location (for COPY_FILE).  */
-      fprintf(fout, "set(CMAKE_RUNTIME_OUTPUT_DIRECTORY \"%s\")\n",
-              this->BinaryDirectory.c_str());
-      /* Create the actual executable.  */
-      fprintf(fout, "add_executable(%s)\n", targetName.c_str());
-    } else // if (targetType == cmStateEnums::STATIC_LIBRARY)
-    {
-      /* Put the static library at a known location (for COPY_FILE).  */
-      fprintf(fout, "set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY \"%s\")\n",
-              this->BinaryDirectory.c_str());
-      /* Create the actual static library.  */
-      fprintf(fout, "add_library(%s STATIC)\n", targetName.c_str());
-    }
-    fprintf(fout, "target_sources(%s PRIVATE\n", targetName.c_str());
-    std::string file_set_name;
-    bool in_file_set = false;
-    for (auto const& source : sources) {
-      auto const& si = source.first;
-      switch (source.second) {
-        case Arguments::SourceType::Normal: {
-          if (in_file_set) {
-            fprintf(fout, "  PRIVATE\n");
-            in_file_set = false;
-          }
-        } break;
-        case Arguments::SourceType::CxxModule: {
-          if (!in_file_set) {
-            file_set_name += 'a';
-            fprintf(fout,
-                    "  PRIVATE FILE_SET %s TYPE CXX_MODULES BASE_DIRS \"%s\" "
-                    "FILES\n",
-                    file_set_name.c_str(),
-                    this->Makefile->GetCurrentSourceDirectory().c_str());
-            in_file_set = true;
-          }
-        } break;
-        case Arguments::SourceType::Directory:
-          /* Handled elsewhere. */
-          break;
-      }
-      fprintf(fout, "  \"%s\"\n", si.c_str());
-
-      // Add dependencies on any non-temporary sources.
-      if (!IsTemporary(si)) {
-        this->Makefile->AddCMakeDependFile(si);
-      }
-    }
-    fprintf(fout, ")\n");
-
-    /* Write out the output location of the target we are building */
-    std::string perConfigGenex;
-    if (this->Makefile->GetGlobalGenerator()->IsMultiConfig()) {
-      perConfigGenex = "_$<UPPER_CASE:$<CONFIG>>";
-    }
-    fprintf(fout,
-            "file(GENERATE OUTPUT "
-            "\"${CMAKE_BINARY_DIR}/%s%s_loc\"\n",
-            targetName.c_str(), perConfigGenex.c_str());
-    fprintf(fout, "     CONTENT $<TARGET_FILE:%s>)\n", targetName.c_str());
-
     bool warnCMP0067 = false;
     bool honorStandard = true;
 
@@ -1047,56 +1341,144 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
       this->Makefile->IssueMessage(MessageType::AUTHOR_WARNING, w.str());
     }
 
-    for (auto const& p : arguments.LangProps) {
-      if (p.second.empty()) {
-        continue;
+    if (arguments.LinkerLanguage &&
+        testLangs.find(*arguments.LinkerLanguage) == testLangs.end()) {
+      this->Makefile->IssueMessage(
+        MessageType::FATAL_ERROR,
+        "Linker language '" + *arguments.LinkerLanguage +
+          "' must be enabled in project(LANGUAGES).");
+    }
+
+    if (targetType == cmStateEnums::EXECUTABLE) {
+      /* Put the executable at a known location (for COPY_FILE).  */
+      fprintf(fout, "set(CMAKE_RUNTIME_OUTPUT_DIRECTORY \"%s\")\n",
+              this->BinaryDirectory.c_str());
+    } else // if (targetType == cmStateEnums::STATIC_LIBRARY)
+    {
+      /* Put the static library at a known location (for COPY_FILE).  */
+      fprintf(fout, "set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY \"%s\")\n",
+              this->BinaryDirectory.c_str());
+    }
+
+    // Add dependencies on any non-temporary sources.
+    for (auto const& source : sources) {
+      if (!IsTemporary(source.first)) {
+        this->Makefile->AddCMakeDependFile(source.first);
       }
-      fprintf(fout, "set_property(TARGET %s PROPERTY %s %s)\n",
-              targetName.c_str(),
-              cmOutputConverter::EscapeForCMake(p.first).c_str(),
-              cmOutputConverter::EscapeForCMake(p.second).c_str());
     }
 
-    if (!arguments.LinkOptions.empty()) {
-      std::vector<std::string> options;
-      options.reserve(arguments.LinkOptions.size());
-      for (const auto& option : arguments.LinkOptions) {
-        options.emplace_back(cmOutputConverter::EscapeForCMake(option));
+    /* Each probe is built as its own target from the common sources and
+       the probe source.  Without probes there is a single target.  */
+    std::vector<std::pair<std::string, std::string const*>> buildTargets;
+    if (probeTargets.empty()) {
+      buildTargets.emplace_back(targetName, nullptr);
+    }
+    for (auto const& probe : probeTargets) {
+      buildTargets.emplace_back(probe.first, &probe.second);
+    }
+
+    for (auto const& buildTarget : buildTargets) {
+      std::string const& tgtName = buildTarget.first;
+      if (targetType == cmStateEnums::EXECUTABLE) {
+        /* Create the actual executable.  */
+        fprintf(fout, "add_executable(%s)\n", tgtName.c_str());
+      } else // if (targetType == cmStateEnums::STATIC_LIBRARY)
+      {
+        /* Create the actual static library.  */
+        fprintf(fout, "add_library(%s STATIC)\n", tgtName.c_str());
+      }
+      fprintf(fout, "target_sources(%s PRIVATE\n", tgtName.c_str());
+      std::string file_set_name;
+      bool in_file_set = false;
+      for (auto const& source : sources) {
+        auto const& si = source.first;
+        switch (source.second) {
+          case Arguments::SourceType::Normal: {
+            if (in_file_set) {
+              fprintf(fout, "  PRIVATE\n");
+              in_file_set = false;
+            }
+          } break;
+          case Arguments::SourceType::CxxModule: {
+            if (!in_file_set) {
+              file_set_name += 'a';
+              fprintf(fout,
+                      "  PRIVATE FILE_SET %s TYPE CXX_MODULES BASE_DIRS "
+                      "\"%s\" FILES\n",
+                      file_set_name.c_str(),
+                      this->Makefile->GetCurrentSourceDirectory().c_str());
+              in_file_set = true;
+            }
+          } break;
+          case Arguments::SourceType::Directory:
+            /* Handled elsewhere. */
+            break;
+        }
+        fprintf(fout, "  \"%s\"\n", si.c_str());
+      }
+      if (buildTarget.second) {
+        if (in_file_set) {
+          fprintf(fout, "  PRIVATE\n");
+        }
+        fprintf(fout, "  \"%s\"\n", buildTarget.second->c_str());
+      }
+      fprintf(fout, ")\n");
+
+      /* Write out the output location of the target we are building */
+      std::string perConfigGenex;
+      if (this->Makefile->GetGlobalGenerator()->IsMultiConfig()) {
+        perConfigGenex = "_$<UPPER_CASE:$<CONFIG>>";
       }
+      fprintf(fout,
+              "file(GENERATE OUTPUT "
+              "\"${CMAKE_BINARY_DIR}/%s%s_loc\"\n",
+              tgtName.c_str(), perConfigGenex.c_str());
+      fprintf(fout, "     CONTENT $<TARGET_FILE:%s>)\n", tgtName.c_str());
 
-      if (targetType == cmStateEnums::STATIC_LIBRARY) {
-        fprintf(fout,
-                "set_property(TARGET %s PROPERTY STATIC_LIBRARY_OPTIONS %s)\n",
-                targetName.c_str(), cmJoin(options, " ").c_str());
-      } else {
-        fprintf(fout, "target_link_options(%s PRIVATE %s)\n",
-                targetName.c_str(), cmJoin(options, " ").c_str());
+      for (auto const& p : arguments.LangProps) {
+        if (p.second.empty()) {
+          continue;
+        }
+        fprintf(fout, "set_property(TARGET %s PROPERTY %s %s)\n",
+                tgtName.c_str(),
+                cmOutputConverter::EscapeForCMake(p.first).c_str(),
+                cmOutputConverter::EscapeForCMake(p.second).c_str());
       }
-    }
 
-    if (arguments.LinkerLanguage) {
-      std::string LinkerLanguage = *arguments.LinkerLanguage;
-      if (testLangs.find(LinkerLanguage) == testLangs.end()) {
-        this->Makefile->IssueMessage(
-          MessageType::FATAL_ERROR,
-          "Linker language '" + LinkerLanguage +
-            "' must be enabled in project(LANGUAGES).");
+      if (!arguments.LinkOptions.empty()) {
+        std::vector<std::string> options;
+        options.reserve(arguments.LinkOptions.size());
+        for (const auto& option : arguments.LinkOptions) {
+          options.emplace_back(cmOutputConverter::EscapeForCMake(option));
+        }
+
+        if (targetType == cmStateEnums::STATIC_LIBRARY) {
+          fprintf(
+            fout,
+            "set_property(TARGET %s PROPERTY STATIC_LIBRARY_OPTIONS %s)\n",
+            tgtName.c_str(), cmJoin(options, " ").c_str());
+        } else {
+          fprintf(fout, "target_link_options(%s PRIVATE %s)\n",
+                  tgtName.c_str(), cmJoin(options, " ").c_str());
+        }
       }
 
-      fprintf(fout, "set_property(TARGET %s PROPERTY LINKER_LANGUAGE %s)\n",
-              targetName.c_str(), LinkerLanguage.c_str());
-    }
+      if (arguments.LinkerLanguage) {
+        fprintf(fout, "set_property(TARGET %s PROPERTY LINKER_LANGUAGE %s)\n",
+                tgtName.c_str(), arguments.LinkerLanguage->c_str());
+      }
 
-    if (arguments.LinkLibraries) {
-      std::string libsToLink = " ";
-      for (std::string const& i : *arguments.LinkLibraries) {
-        libsToLink += cmStrCat('"', cmTrimWhitespace(i), "\" ");
+      if (arguments.LinkLibraries) {
+        std::string libsToLink = " ";
+        for (std::string const& i : *arguments.LinkLibraries) {
+          libsToLink += cmStrCat('"', cmTrimWhitespace(i), "\" ");
+        }
+        fprintf(fout, "target_link_libraries(%s %s)\n", tgtName.c_str(),
+                libsToLink.c_str());
+      } else {
+        fprintf(fout, "target_link_libraries(%s ${LINK_LIBRARIES})\n",
+                tgtName.c_str());
       }
-      fprintf(fout, "target_link_libraries(%s %s)\n", targetName.c_str(),
-              libsToLink.c_str());
-    } else {
-      fprintf(fout, "target_link_libraries(%s ${LINK_LIBRARIES})\n",
-              targetName.c_str());
     }
     fclose(fout);
   }
@@ -1272,11 +1654,43 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
   bool erroroc = cmSystemTools::GetErrorOccurredFlag();
   cmSystemTools::ResetErrorOccurredFlag();
   std::string output;
-  // actually do the try compile now that everything is setup
-  int res = this->Makefile->TryCompile(
-    sourceDirectory, this->BinaryDirectory, projectName, targetName,
-    this->SrcFileSignature, cmake::NO_BUILD_PARALLEL_LEVEL,
-    &arguments.CMakeFlags, output);
+  int res = 0;
+  TryCompileResultCache resultCache(this->Makefile, this->BinaryDirectory,
+                                    targetName);
+  bool const useResultCache = this->SrcFileSignature &&
+    probeTargets.empty() && resultCache.IsEnabled() &&
+    !this->Makefile->GetCMakeInstance()->GetDebugTryCompile();
+  if (useResultCache) {
+    resultCache.ComputeKey(sourceFiles, arguments.CMakeFlags);
+  }
+  bool const cacheHit = useResultCache && resultCache.Load(res, output);
+#ifndef CMAKE_BOOTSTRAP
+  cmake* cm = this->Makefile->GetCMakeInstance();
+  if (useResultCache && cm->IsProfilingEnabled()) {
+    cm->GetProfilingOutput().IncrementCounter("try_compile_cache",
+                                              cacheHit ? "hits" : "misses");
+  }
+#endif
+  if (!cacheHit) {
+    // actually do the try compile now that everything is setup
+    // Probes are independent targets, so build them all in parallel.
+    res = this->Makefile->TryCompile(
+      sourceDirectory, this->BinaryDirectory, projectName,
+      probeTargets.empty() ? targetName : std::string(),
+      this->SrcFileSignature,
+      probeTargets.empty() ? cmake::NO_BUILD_PARALLEL_LEVEL
+                           : ProbeBuildParallelLevel(),
+      &arguments.CMakeFlags, output);
+    // Store only successes.  A failure may come from a header or library
+    // that is not part of the key and that may be installed later.
+    if (useResultCache && res == 0 &&
+        !cmSystemTools::GetErrorOccurredFlag()) {
+      this->FindOutputFile(targetName);
+      if (!this->OutputFile.empty()) {
+        resultCache.Store(res, output, this->OutputFile);
+      }
+    }
+  }
   if (erroroc) {
     cmSystemTools::SetErrorOccurred();
   }
@@ -1291,13 +1705,40 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
       "Result of TRY_COMPILE", cmStateEnums::INTERNAL);
   }
 
+  for (std::size_t i = 0; i < probeTargets.size(); ++i) {
+    int probeRes = res;
+    if (res != 0 && !cmSystemTools::GetFatalErrorOccurred()) {
+      // The parallel build may have stopped before building every probe,
+      // so build the probe alone.  Probes built already are up to date.
+      std::string probeOutput;
+      probeRes = this->Makefile->GetGlobalGenerator()->TryCompile(
+        cmake::NO_BUILD_PARALLEL_LEVEL, sourceDirectory,
+        this->BinaryDirectory, projectName, probeTargets[i].first, true,
+        probeOutput, this->Makefile);
+      output += probeOutput;
+    }
+    std::string const& probeVar = arguments.Probes[i][0];
+    if (arguments.NoCache) {
+      this->Makefile->AddDefinition(probeVar,
+                                    (probeRes == 0 ? "TRUE" : "FALSE"));
+    } else {
+      this->Makefile->AddCacheDefinition(
+        probeVar, (probeRes == 0 ? "TRUE" : "FALSE"), "Result of TRY_COMPILE",
+        cmStateEnums::INTERNAL);
+    }
+  }
+
   if (arguments.OutputVariable) {
     this->Makefile->AddDefinition(*arguments.OutputVariable, output);
   }
 
   if (this->SrcFileSignature) {
     std::string copyFileErrorMessage;
-    this->FindOutputFile(targetName);
+    // With probes only the probe targets are built, so there is no
+    // output file to find.
+    if (probeTargets.empty()) {
+      this->FindOutputFile(targetName);
+    }
 
     if ((res == 0) && arguments.CopyFileTo) {
       std::string const& copyFile = *arguments.CopyFileTo;
@@ -1424,20 +1865,8 @@ void cmCoreTryCompile::FindOutputFile(const std::string& targetName)
 {
   this->FindErrorMessage.clear();
   this->OutputFile.clear();
-  std::string tmpOutputFile = "/";
-  tmpOutputFile += targetName;
-
-  if (this->Makefile->GetGlobalGenerator()->IsMultiConfig()) {
-    std::string const tcConfig =
-      this->Makefile->GetSafeDefinition("CMAKE_TRY_COMPILE_CONFIGURATION");
-    std::string const cfg = !tcConfig.empty()
-      ? cmSystemTools::UpperCase(tcConfig)
-      : TryCompileDefaultConfig;
-    tmpOutputFile = cmStrCat(tmpOutputFile, '_', cfg);
-  }
-  tmpOutputFile += "_loc";
-
-  std::string command = cmStrCat(this->BinaryDirectory, tmpOutputFile);
+  std::string command = cmStrCat(
+    this->BinaryDirectory, OutputFileLocationName(this->Makefile, targetName));
   if (!cmSystemTools::FileExists(command)) {
     std::ostringstream emsg;
     emsg << "Unable to find the recorded try_compile output location:\n";
@@ -84,6 +84,7 @@ public:
     cm::optional<ArgumentParser::NonEmpty<
       std::vector<std::pair<std::string, SourceType>>>>
       SourceFromFile;
+    std::vector<std::vector<std::string>> Probes;
     ArgumentParser::MaybeEmpty<std::vector<std::string>> CMakeFlags{
       1, "CMAKE_FLAGS"
     }; // fake argv[0]
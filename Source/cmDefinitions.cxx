@@ -27,9 +27,12 @@ cmDefinitions::Def const& cmDefinitions::GetInternal(const std::string& key,
     return cmDefinitions::NoDef;
   }
   Def const& def = cmDefinitions::GetInternal(key, it, end, raise);
-  if (!raise) {
+  if (!raise && &def == &cmDefinitions::NoDef) {
     return def;
   }
+  // A parent scope cannot change while this scope exists except through
+  // Raise, which localizes the definition first.  Save the result here so
+  // that later lookups do not search the parent scopes again.
   return begin->Map.emplace(key, def).first->second;
 }
 
@@ -46,6 +49,18 @@ void cmDefinitions::Raise(const std::string& key, StackIter begin,
   cmDefinitions::GetInternal(key, begin, end, true);
 }
 
+bool cmDefinitions::Append(const std::string& key, cm::string_view value,
+                           StackIter begin, StackIter end)
+{
+  Def const& def = cmDefinitions::GetInternal(key, begin, end, false);
+  if (!def.Value) {
+    return false;
+  }
+  // GetInternal saved a definition found in a parent scope locally.
+  begin->Map.find(cm::String::borrow(key))->second.Value += value;
+  return true;
+}
+
 bool cmDefinitions::HasKey(const std::string& key, StackIter begin,
                            StackIter end)
 {
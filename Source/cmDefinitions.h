@@ -32,6 +32,12 @@ public:
 
   static void Raise(const std::string& key, StackIter begin, StackIter end);
 
+  /** Append to the value of a definition in the given scope.  The value
+      is extended in place unless it is shared with another scope.
+      Returns false if the key is not defined.  */
+  static bool Append(const std::string& key, cm::string_view value,
+                     StackIter begin, StackIter end);
+
   static bool HasKey(const std::string& key, StackIter begin, StackIter end);
 
   static std::vector<std::string> ClosureKeys(StackIter begin, StackIter end);
@@ -45,6 +45,8 @@ cmExportBuildFileGenerator::cmExportBuildFileGenerator()
 void cmExportBuildFileGenerator::Compute(cmLocalGenerator* lg)
 {
   this->LG = lg;
+  this->DeclarativeTargets =
+    lg->GetMakefile()->IsOn("CMAKE_EXPORT_DECLARATIVE_TARGETS");
   if (this->ExportSet) {
     this->ExportSet->Compute(lg);
   }
@@ -82,10 +84,13 @@ bool cmExportBuildFileGenerator::GenerateMainFile(std::ostream& os)
     this->GenerateExpectedTargetsCode(os, expectedTargets);
   }
 
-  // Create all the imported targets.
+  // Create all the imported targets.  Declared targets are all created
+  // before the code that follows them in the loop.
+  std::ostringstream targetsCode;
   for (auto const& exp : this->Exports) {
     cmGeneratorTarget* gte = exp.Target;
-    this->GenerateImportTargetCode(os, gte, this->GetExportTargetType(gte));
+    this->GenerateImportTargetCode(targetsCode, gte,
+                                   this->GetExportTargetType(gte));
 
     gte->Target->AppendBuildInterfaceIncludes();
 
@@ -155,10 +160,12 @@ bool cmExportBuildFileGenerator::GenerateMainFile(std::ostream& os)
     this->PopulateCustomTransitiveInterfaceProperties(
       gte, cmGeneratorExpression::BuildInterface, properties);
 
-    this->GenerateInterfaceProperties(gte, os, properties);
+    this->GenerateInterfaceProperties(gte, targetsCode, properties);
 
-    this->GenerateTargetFileSets(gte, os);
+    this->GenerateTargetFileSets(gte, targetsCode);
   }
+  this->GenerateDeclaredTargetsCode(os, std::string());
+  os << targetsCode.str();
 
   std::string cxx_modules_name;
   if (this->ExportSet) {
@@ -22,6 +22,7 @@
 #include "cmFindPackageStack.h"
 #include "cmGeneratedFileStream.h"
 #include "cmGeneratorTarget.h"
+#include "cmGlobalGenerator.h"
 #include "cmLinkItem.h"
 #include "cmList.h"
 #include "cmLocalGenerator.h"
@@ -145,6 +146,7 @@ void cmExportFileGenerator::GenerateImportConfig(std::ostream& os,
 
   // Generate the per-config target information.
   this->GenerateImportTargetsConfig(os, config, suffix);
+  this->GenerateDeclaredTargetsCode(os, suffix.substr(1));
 }
 
 void cmExportFileGenerator::PopulateInterfaceProperty(
@@ -633,6 +635,14 @@ void cmExportFileGenerator::GenerateInterfaceProperties(
   if (!properties.empty()) {
     std::string targetName =
       cmStrCat(this->Namespace, target->GetExportName());
+    if (this->DeclarativeTargets && !this->DeclaredTargets.empty() &&
+        this->DeclaredTargets.back().Name == targetName) {
+      for (auto const& property : properties) {
+        this->DeclaredTargets.back().Properties[property.first] =
+          property.second;
+      }
+      return;
+    }
     os << "set_target_properties(" << targetName << " PROPERTIES\n";
     for (auto const& property : properties) {
       os << "  " << property.first << " "
@@ -1100,10 +1110,90 @@ void cmExportFileGenerator::GenerateExpectedTargetsCode(
   /* clang-format on */
 }
 
+void cmExportFileGenerator::GenerateDeclaredTargetsCode(
+  std::ostream& os, std::string const& configuration)
+{
+  if (this->DeclaredTargets.empty()) {
+    return;
+  }
+
+  auto jsonString = [](std::string const& str) -> std::string {
+    return cmStrCat('"', cmGlobalGenerator::EscapeJSON(str), '"');
+  };
+
+  bool createsTargets = false;
+  std::string json = "{\n";
+  if (!configuration.empty()) {
+    json += cmStrCat("  \"configuration\": ", jsonString(configuration),
+                     ",\n");
+  }
+  json += "  \"targets\": [";
+  const char* sep = "\n";
+  for (DeclaredTarget const& declared : this->DeclaredTargets) {
+    json += cmStrCat(sep, "    {\n      \"name\": ",
+                     jsonString(declared.Name));
+    sep = ",\n";
+    if (!declared.Type.empty()) {
+      createsTargets = true;
+      json += cmStrCat(",\n      \"type\": ", jsonString(declared.Type));
+    }
+    if (!declared.Properties.empty()) {
+      json += ",\n      \"properties\": {";
+      const char* psep = "\n";
+      for (auto const& property : declared.Properties) {
+        json += cmStrCat(psep, "        ", jsonString(property.first), ": ",
+                         jsonString(property.second));
+        psep = ",\n";
+      }
+      json += "\n      }";
+    }
+    if (declared.ImportCheck) {
+      json += ",\n      \"importCheckFiles\": [";
+      const char* fsep = "";
+      for (std::string const& file : declared.ImportCheckFiles) {
+        json += cmStrCat(fsep, jsonString(file));
+        fsep = ", ";
+      }
+      json += "]";
+    }
+    json += "\n    }";
+  }
+  json += "\n  ]\n}\n";
+  this->DeclaredTargets.clear();
+
+  // Pick a bracket argument delimiter that does not occur in the data.
+  std::string close = "]=]";
+  while (json.find(close) != std::string::npos) {
+    close.insert(1, 1, '=');
+  }
+  std::string const equals = close.substr(1, close.size() - 2);
+
+  if (createsTargets) {
+    /* clang-format off */
+    os << "if(NOT COMMAND cmake_import_targets)\n"
+          "  message(FATAL_ERROR \"This file was generated with "
+          "CMAKE_EXPORT_DECLARATIVE_TARGETS and requires a CMake version "
+          "that provides the cmake_import_targets command.\")\n"
+          "endif()\n"
+          "\n"
+          "# Create imported targets\n";
+    /* clang-format on */
+  } else {
+    os << "# Import targets for configuration \"" << configuration << "\"\n";
+  }
+  os << "cmake_import_targets(JSON [" << equals << "[\n"
+     << json << ']' << equals << "])\n\n";
+}
+
 void cmExportFileGenerator::GenerateImportTargetCode(
   std::ostream& os, cmGeneratorTarget const* target,
   cmStateEnums::TargetType targetType)
 {
+  if (this->DeclarativeTargets) {
+    this->DeclareImportTarget(target, targetType);
+    return;
+  }
+
   // Construct the imported target name.
   std::string targetName = this->Namespace;
 
@@ -1177,6 +1267,65 @@ void cmExportFileGenerator::GenerateImportTargetCode(
   os << "\n";
 }
 
+void cmExportFileGenerator::DeclareImportTarget(
+  cmGeneratorTarget const* target, cmStateEnums::TargetType targetType)
+{
+  DeclaredTarget declared;
+  declared.Name = cmStrCat(this->Namespace, target->GetExportName());
+  switch (targetType) {
+    case cmStateEnums::EXECUTABLE:
+      declared.Type = "EXECUTABLE";
+      break;
+    case cmStateEnums::STATIC_LIBRARY:
+      declared.Type = "STATIC";
+      break;
+    case cmStateEnums::SHARED_LIBRARY:
+      declared.Type = "SHARED";
+      break;
+    case cmStateEnums::MODULE_LIBRARY:
+      declared.Type = "MODULE";
+      break;
+    case cmStateEnums::UNKNOWN_LIBRARY:
+      declared.Type = "UNKNOWN";
+      break;
+    case cmStateEnums::OBJECT_LIBRARY:
+      declared.Type = "OBJECT";
+      break;
+    case cmStateEnums::INTERFACE_LIBRARY:
+      declared.Type = "INTERFACE";
+      break;
+    default: // should never happen
+      return;
+  }
+
+  // Record the same properties GenerateImportTargetCode sets.
+  ImportPropertyMap& properties = declared.Properties;
+  if (target->IsExecutableWithExports() ||
+      (target->IsSharedLibraryWithExports() && target->HasImportLibrary(""))) {
+    properties["ENABLE_EXPORTS"] = "1";
+  }
+  if (target->IsFrameworkOnApple()) {
+    properties["FRAMEWORK"] = "1";
+  }
+  if (target->IsAppBundleOnApple()) {
+    properties["MACOSX_BUNDLE"] = "1";
+  }
+  if (target->IsCFBundleOnApple()) {
+    properties["BUNDLE"] = "1";
+  }
+  if (target->IsDeprecated()) {
+    properties["DEPRECATION"] = target->GetDeprecation();
+  }
+  if (target->GetPropertyAsBool("IMPORTED_NO_SYSTEM")) {
+    properties["IMPORTED_NO_SYSTEM"] = "1";
+  }
+  if (target->GetPropertyAsBool("EXPORT_NO_SYSTEM")) {
+    properties["SYSTEM"] = "0";
+  }
+
+  this->DeclaredTargets.emplace_back(std::move(declared));
+}
+
 void cmExportFileGenerator::GenerateImportPropertyCode(
   std::ostream& os, const std::string& config, const std::string& suffix,
   cmGeneratorTarget const* target, ImportPropertyMap const& properties,
@@ -1187,6 +1336,16 @@ void cmExportFileGenerator::GenerateImportPropertyCode(
 
   targetName += target->GetExportName();
 
+  // The XCFramework location is chosen by code in the file, so only the
+  // plain properties can be declared.
+  if (this->DeclarativeTargets && importedXcFrameworkLocation.empty()) {
+    DeclaredTarget declared;
+    declared.Name = std::move(targetName);
+    declared.Properties = properties;
+    this->DeclaredTargets.emplace_back(std::move(declared));
+    return;
+  }
+
   // Set the import properties.
   os << "# Import target \"" << targetName << "\" for configuration \""
      << config << "\"\n";
@@ -1393,6 +1552,20 @@ void cmExportFileGenerator::GenerateImportedFileChecksCode(
   // Construct the imported target name.
   std::string targetName = cmStrCat(this->Namespace, target->GetExportName());
 
+  if (this->DeclarativeTargets && importedXcFrameworkLocation.empty() &&
+      !this->DeclaredTargets.empty() &&
+      this->DeclaredTargets.back().Name == targetName) {
+    DeclaredTarget& declared = this->DeclaredTargets.back();
+    declared.ImportCheck = true;
+    for (std::string const& li : importedLocations) {
+      auto pi = properties.find(li);
+      if (pi != properties.end()) {
+        declared.ImportCheckFiles.push_back(pi->second);
+      }
+    }
+    return;
+  }
+
   os << "list(APPEND _cmake_import_check_targets " << targetName << " )\n";
   if (!importedXcFrameworkLocation.empty()) {
     os << "set(_cmake_import_check_xcframework_for_" << targetName << ' '
@@ -67,6 +67,13 @@ public:
     this->ExportPackageDependencies = exportPackageDependencies;
   }
 
+  /** Describe the imported targets as data loaded by one
+      cmake_import_targets() call instead of one command per property.  */
+  void SetDeclarativeTargets(bool declarativeTargets)
+  {
+    this->DeclarativeTargets = declarativeTargets;
+  }
+
 protected:
   using ImportPropertyMap = std::map<std::string, std::string>;
 
@@ -100,6 +107,12 @@ protected:
   virtual void GenerateExpectedTargetsCode(std::ostream& os,
                                            const std::string& expectedTargets);
 
+  // Write the targets collected in declarative mode as one
+  // cmake_import_targets() call.  A non-empty configuration is appended
+  // to the IMPORTED_CONFIGURATIONS of each target.
+  void GenerateDeclaredTargetsCode(std::ostream& os,
+                                   std::string const& configuration);
+
   // Collect properties with detailed information about targets beyond
   // their location on disk.
   void SetImportDetailProperties(const std::string& config,
@@ -238,6 +251,19 @@ protected:
 
   bool ExportPackageDependencies = false;
 
+  struct DeclaredTarget
+  {
+    std::string Name;
+    // The type of an imported target to create, or empty to set
+    // properties on an existing target.
+    std::string Type;
+    ImportPropertyMap Properties;
+    bool ImportCheck = false;
+    std::vector<std::string> ImportCheckFiles;
+  };
+  bool DeclarativeTargets = false;
+  std::vector<DeclaredTarget> DeclaredTargets;
+
 private:
   void PopulateInterfaceProperty(const std::string&, const std::string&,
                                  cmGeneratorTarget const* target,
@@ -251,6 +277,9 @@ private:
                                            cmGeneratorTarget const* target,
                                            cmLocalGenerator const* lg);
 
+  void DeclareImportTarget(cmGeneratorTarget const* target,
+                           cmStateEnums::TargetType targetType);
+
   virtual void ReplaceInstallPrefix(std::string& input);
 
   virtual std::string InstallNameDir(cmGeneratorTarget const* target,
@@ -77,7 +77,9 @@ bool cmExportInstallFileGenerator::GenerateMainFile(std::ostream& os)
   this->GenerateImportPrefix(os);
 
   bool requiresConfigFiles = false;
-  // Create all the imported targets.
+  // Create all the imported targets.  Declared targets are all created
+  // before the code that follows them in the loop.
+  std::ostringstream targetsCode;
   for (cmTargetExport* te : allTargets) {
     cmGeneratorTarget* gt = te->Target;
     cmStateEnums::TargetType targetType = this->GetExportTargetType(te);
@@ -85,7 +87,7 @@ bool cmExportInstallFileGenerator::GenerateMainFile(std::ostream& os)
     requiresConfigFiles =
       requiresConfigFiles || targetType != cmStateEnums::INTERFACE_LIBRARY;
 
-    this->GenerateImportTargetCode(os, gt, targetType);
+    this->GenerateImportTargetCode(targetsCode, gt, targetType);
 
     ImportPropertyMap properties;
 
@@ -163,10 +165,12 @@ bool cmExportInstallFileGenerator::GenerateMainFile(std::ostream& os)
     this->PopulateCustomTransitiveInterfaceProperties(
       gt, cmGeneratorExpression::InstallInterface, properties);
 
-    this->GenerateInterfaceProperties(gt, os, properties);
+    this->GenerateInterfaceProperties(gt, targetsCode, properties);
 
-    this->GenerateTargetFileSets(gt, os, te);
+    this->GenerateTargetFileSets(gt, targetsCode, te);
   }
+  this->GenerateDeclaredTargetsCode(os, std::string());
+  os << targetsCode.str();
 
   this->LoadConfigFiles(os);
 
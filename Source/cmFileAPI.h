@@ -24,6 +24,9 @@ public:
   /** Read fileapi queries from disk.  */
   void ReadQueries();
 
+  /** Return true if the build tree has any queries.  */
+  bool HasQueries() const { return this->QueryExists; }
+
   /** Get the list of configureLog object kind versions requested.  */
   std::vector<unsigned long> GetConfigureLogVersions();
 
@@ -2,6 +2,7 @@
    file Copyright.txt or https://cmake.org/licensing for details.  */
 #include "cmFileTime.h"
 
+#include <chrono>
 #include <string>
 
 // Use a platform-specific API to get file times efficiently.
@@ -48,3 +49,22 @@ bool cmFileTime::Load(std::string const& fileName)
 #endif
   return true;
 }
+
+void cmFileTime::LoadCurrentTime()
+{
+#if !defined(_WIN32) || defined(__CYGWIN__)
+  // POSIX version.  File times count from the epoch of the system clock.
+  auto const now = std::chrono::system_clock::now().time_since_epoch();
+  this->Time = static_cast<TimeType>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+#else
+  // Windows version.  Use the same representation as file times.
+  FILETIME ft;
+  GetSystemTimeAsFileTime(&ft);
+
+  using uint64 = unsigned long long;
+
+  this->Time = static_cast<TimeType>((uint64(ft.dwHighDateTime) << 32) +
+                                     ft.dwLowDateTime);
+#endif
+}
@@ -33,6 +33,11 @@ public:
    */
   bool Load(std::string const& fileName);
 
+  /**
+   * @brief Loads the current time of the system clock
+   */
+  void LoadCurrentTime();
+
   /**
    * @brief Return true if this is older than ftm
    */
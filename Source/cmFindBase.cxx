@@ -601,6 +601,20 @@ void cmFindBase::StoreFindResult(const std::string& value)
   }
 }
 
+#if !defined(CMAKE_BOOTSTRAP)
+cm::optional<cmMakefileProfilingData::RAII>
+cmFindBase::CreateSearchProfilingEntry() const
+{
+  return this->Makefile->GetCMakeInstance()->CreateProfilingEntry(
+    "find", this->VariableName, [this]() -> Json::Value {
+      Json::Value args = Json::objectValue;
+      args["command"] = this->FindCommandName;
+      args["names"] = cmJoin(this->Names, ";");
+      return args;
+    });
+}
+#endif
+
 cmFindBaseDebugState::cmFindBaseDebugState(std::string commandName,
                                            cmFindBase const* findBase)
   : FindCommand(findBase)
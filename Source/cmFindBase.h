@@ -11,6 +11,12 @@
 #include "cmFindCommon.h"
 #include "cmStateTypes.h"
 
+#if !defined(CMAKE_BOOTSTRAP)
+#  include <cm/optional>
+
+#  include "cmMakefileProfilingData.h"
+#endif
+
 class cmExecutionStatus;
 
 /** \class cmFindBase
@@ -48,6 +54,12 @@ protected:
   void NormalizeFindResult();
   void StoreFindResult(const std::string& value);
 
+#if !defined(CMAKE_BOOTSTRAP)
+  // Time the search for the result variable in the profiling output.
+  cm::optional<cmMakefileProfilingData::RAII> CreateSearchProfilingEntry()
+    const;
+#endif
+
   // actual find command name
   std::string FindCommandName;
 
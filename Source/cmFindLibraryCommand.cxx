@@ -71,6 +71,9 @@ bool cmFindLibraryCommand::InitialPass(std::vector<std::string> const& argsIn)
     this->AddArchitecturePaths("x32");
   }
 
+#if !defined(CMAKE_BOOTSTRAP)
+  auto profilingRAII = this->CreateSearchProfilingEntry();
+#endif
   std::string const library = this->FindLibrary();
   this->StoreFindResult(library);
   return true;
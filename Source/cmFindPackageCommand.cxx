@@ -22,6 +22,7 @@
 
 #include "cmAlgorithms.h"
 #include "cmDependencyProvider.h"
+#include "cmGlobalGenerator.h"
 #include "cmList.h"
 #include "cmListFileCache.h"
 #include "cmMakefile.h"
@@ -36,6 +37,7 @@
 #include "cmValue.h"
 #include "cmVersion.h"
 #include "cmWindowsRegistry.h"
+#include "cmake.h"
 
 #if defined(__HAIKU__)
 #  include <FindDirectory.h>
@@ -81,6 +83,19 @@ std::size_t collectPathsForDebug(std::string& buffer,
   return paths.size();
 }
 
+// Check whether the content listing of a directory may have the given file
+// name.  A name listed in another case is accepted too, because the file
+// system may compare names case-insensitively even on hosts where that is
+// not the default.  Callers still check each accepted name on disk.
+bool directoryContentHas(cmGlobalGenerator* gg, std::string const& dir,
+                         std::set<std::string> const& content,
+                         std::string const& name)
+{
+  return content.count(name) != 0 ||
+    gg->GetDirectoryContentLowerCase(dir).count(
+      cmSystemTools::LowerCase(name)) != 0;
+}
+
 #if !(defined(_WIN32) && !defined(__CYGWIN__))
 class cmFindPackageCommandHoldFile
 {
@@ -104,14 +119,6 @@ public:
 };
 #endif
 
-bool isDirentryToIgnore(const char* const fname)
-{
-  assert(fname != nullptr);
-  assert(fname[0] != 0);
-  return fname[0] == '.' &&
-    (fname[1] == 0 || (fname[1] == '.' && fname[2] == 0));
-}
-
 class cmAppendPathSegmentGenerator
 {
 public:
@@ -163,8 +170,9 @@ private:
 class cmCaseInsensitiveDirectoryListGenerator
 {
 public:
-  cmCaseInsensitiveDirectoryListGenerator(cm::string_view name)
-    : DirectoryLister{}
+  cmCaseInsensitiveDirectoryListGenerator(cmGlobalGenerator* gg,
+                                          cm::string_view name)
+    : GlobalGenerator{ gg }
     , DirName{ name }
   {
   }
@@ -172,24 +180,24 @@ public:
   std::string GetNextCandidate(const std::string& parent)
   {
     if (!this->Loaded) {
-      this->CurrentIdx = 0ul;
+      // Collect the names now because the directory content cache may
+      // be updated while the candidates are searched.
+      this->Matches.clear();
       this->Loaded = true;
-      if (!this->DirectoryLister.Load(parent)) {
-        return {};
+      for (std::string const& fname :
+           this->GlobalGenerator->GetDirectoryContent(parent)) {
+        if (cmsysString_strcasecmp(fname.c_str(), this->DirName.data()) ==
+            0) {
+          this->Matches.emplace_back(fname);
+        }
       }
+      this->Current = this->Matches.cbegin();
     }
 
-    while (this->CurrentIdx < this->DirectoryLister.GetNumberOfFiles()) {
-      const char* const fname =
-        this->DirectoryLister.GetFile(this->CurrentIdx++);
-      if (isDirentryToIgnore(fname)) {
-        continue;
-      }
-      if (cmsysString_strcasecmp(fname, this->DirName.data()) == 0) {
-        auto candidate = cmStrCat(parent, '/', fname);
-        if (cmSystemTools::FileIsDirectory(candidate)) {
-          return candidate;
-        }
+    while (this->Current != this->Matches.cend()) {
+      auto candidate = cmStrCat(parent, '/', *this->Current++);
+      if (cmSystemTools::FileIsDirectory(candidate)) {
+        return candidate;
       }
     }
     return {};
@@ -198,17 +206,20 @@ public:
   void Reset() { this->Loaded = false; }
 
 private:
-  cmsys::Directory DirectoryLister;
+  cmGlobalGenerator* const GlobalGenerator;
   const cm::string_view DirName;
-  unsigned long CurrentIdx = 0ul;
+  std::vector<std::string> Matches;
+  std::vector<std::string>::const_iterator Current;
   bool Loaded = false;
 };
 
 class cmDirectoryListGenerator
 {
 public:
-  cmDirectoryListGenerator(std::vector<std::string> const& names)
-    : Names{ names }
+  cmDirectoryListGenerator(cmGlobalGenerator* gg,
+                           std::vector<std::string> const& names)
+    : GlobalGenerator{ gg }
+    , Names{ names }
     , Matches{}
     , Current{ this->Matches.cbegin() }
   {
@@ -219,24 +230,11 @@ public:
   {
     // Construct a list of matches if not yet
     if (this->Matches.empty()) {
-      cmsys::Directory directoryLister;
-      // ALERT `Directory::Load()` keeps only names
-      // internally and LOST entry type from `dirent`.
-      // So, `Directory::FileIsDirectory` gonna use
-      // `SystemTools::FileIsDirectory()` and waste a syscall.
-      // TODO Need to enhance the `Directory` class.
-      directoryLister.Load(parent);
-
-      // ATTENTION Is it guaranteed that first two entries are
-      // `.` and `..`?
-      // TODO If so, just start with index 2 and drop the
-      // `isDirentryToIgnore(i)` condition to check.
-      for (auto i = 0ul; i < directoryLister.GetNumberOfFiles(); ++i) {
-        const char* const fname = directoryLister.GetFile(i);
-        if (isDirentryToIgnore(fname)) {
-          continue;
-        }
-
+      // The global generator caches directory content by name only, so
+      // entries matching a name are checked to be directories here.
+      std::set<std::string> const& files =
+        this->GlobalGenerator->GetDirectoryContent(parent);
+      for (std::string const& fname : files) {
         for (const auto& n : this->Names.get()) {
           // NOTE Customization point for `cmMacProjectDirectoryListGenerator`
           const auto name = this->TransformNameBeforeCmp(n);
@@ -244,8 +242,10 @@ public:
           // ATTENTION BTW, original code also didn't check if it's a symlink
           // to a directory!
           const auto equal =
-            (cmsysString_strncasecmp(fname, name.c_str(), name.length()) == 0);
-          if (equal && directoryLister.FileIsDirectory(i)) {
+            (cmsysString_strncasecmp(fname.c_str(), name.c_str(),
+                                     name.length()) == 0);
+          if (equal &&
+              cmSystemTools::FileIsDirectory(cmStrCat(parent, '/', fname))) {
             this->Matches.emplace_back(fname);
           }
         }
@@ -274,6 +274,7 @@ protected:
   virtual void OnMatchesLoaded() {}
   virtual std::string TransformNameBeforeCmp(std::string same) { return same; }
 
+  cmGlobalGenerator* const GlobalGenerator;
   std::reference_wrapper<const std::vector<std::string>> Names;
   std::vector<std::string> Matches;
   std::vector<std::string>::const_iterator Current;
@@ -282,10 +283,11 @@ protected:
 class cmProjectDirectoryListGenerator : public cmDirectoryListGenerator
 {
 public:
-  cmProjectDirectoryListGenerator(std::vector<std::string> const& names,
+  cmProjectDirectoryListGenerator(cmGlobalGenerator* gg,
+                                  std::vector<std::string> const& names,
                                   cmFindPackageCommand::SortOrderType so,
                                   cmFindPackageCommand::SortDirectionType sd)
-    : cmDirectoryListGenerator{ names }
+    : cmDirectoryListGenerator{ gg, names }
     , SortOrder{ so }
     , SortDirection{ sd }
   {
@@ -310,9 +312,10 @@ private:
 class cmMacProjectDirectoryListGenerator : public cmDirectoryListGenerator
 {
 public:
-  cmMacProjectDirectoryListGenerator(const std::vector<std::string>& names,
+  cmMacProjectDirectoryListGenerator(cmGlobalGenerator* gg,
+                                     const std::vector<std::string>& names,
                                      cm::string_view ext)
-    : cmDirectoryListGenerator{ names }
+    : cmDirectoryListGenerator{ gg, names }
     , Extension{ ext }
   {
   }
@@ -1695,6 +1698,17 @@ bool cmFindPackageCommand::HandlePackageMode(
 
 bool cmFindPackageCommand::FindConfig()
 {
+#if !defined(CMAKE_BOOTSTRAP)
+  auto profilingRAII =
+    this->Makefile->GetCMakeInstance()->CreateProfilingEntry(
+      "find", this->Name, [this]() -> Json::Value {
+        Json::Value args = Json::objectValue;
+        args["command"] = "find_package";
+        args["names"] = cmJoin(this->Names, ";");
+        return args;
+      });
+#endif
+
   // Compute the set of search prefixes.
   this->ComputePrefixes();
 
@@ -2459,12 +2473,19 @@ bool cmFindPackageCommand::FindConfigFile(std::string const& dir,
     return false;
   }
 
+  // The global generator indexes the content of each directory once and
+  // re-reads it only when the directory is modified.  Candidates missing
+  // from it are rejected without probing the file system, so searching a
+  // prefix that does not have the package costs one stat per directory.
+  cmGlobalGenerator* gg = this->Makefile->GetGlobalGenerator();
+  std::set<std::string> const& content = gg->GetDirectoryContent(dir);
   for (std::string const& c : this->Configs) {
     file = cmStrCat(dir, '/', c);
     if (this->DebugMode) {
       this->DebugBuffer = cmStrCat(this->DebugBuffer, "  ", file, "\n");
     }
-    if (cmSystemTools::FileExists(file, true) && this->CheckVersion(file)) {
+    if (directoryContentHas(gg, dir, content, c) &&
+        cmSystemTools::FileExists(file, true) && this->CheckVersion(file)) {
       // Allow resolving symlinks when the config file is found through a link
       if (this->UseRealPath) {
         file = cmSystemTools::GetRealPath(file);
@@ -2484,17 +2505,25 @@ bool cmFindPackageCommand::CheckVersion(std::string const& config_file)
   // Get the filename without the .cmake extension.
   std::string::size_type pos = config_file.rfind('.');
   std::string version_file_base = config_file.substr(0, pos);
+  cmGlobalGenerator* gg = this->Makefile->GetGlobalGenerator();
+  std::string const dir = cmSystemTools::GetFilenamePath(config_file);
+  std::set<std::string> const& content = gg->GetDirectoryContent(dir);
+  auto versionFileExists = [gg, &dir, &content](std::string const& f) {
+    return directoryContentHas(gg, dir, content,
+                               cmSystemTools::GetFilenameName(f)) &&
+      cmSystemTools::FileExists(f, true);
+  };
 
   // Look for foo-config-version.cmake
   std::string version_file = cmStrCat(version_file_base, "-version.cmake");
-  if (!haveResult && cmSystemTools::FileExists(version_file, true)) {
+  if (!haveResult && versionFileExists(version_file)) {
     result = this->CheckVersionFile(version_file, version);
     haveResult = true;
   }
 
   // Look for fooConfigVersion.cmake
   version_file = cmStrCat(version_file_base, "Version.cmake");
-  if (!haveResult && cmSystemTools::FileExists(version_file, true)) {
+  if (!haveResult && versionFileExists(version_file)) {
     result = this->CheckVersionFile(version_file, version);
     haveResult = true;
   }
@@ -2664,10 +2693,11 @@ bool cmFindPackageCommand::SearchPrefix(std::string const& prefix_in)
   auto searchFn = [this](const std::string& fullPath) -> bool {
     return this->SearchDirectory(fullPath);
   };
+  cmGlobalGenerator* const gg = this->Makefile->GetGlobalGenerator();
 
-  auto iCMakeGen = cmCaseInsensitiveDirectoryListGenerator{ "cmake"_s };
+  auto iCMakeGen = cmCaseInsensitiveDirectoryListGenerator{ gg, "cmake"_s };
   auto firstPkgDirGen =
-    cmProjectDirectoryListGenerator{ this->Names, this->SortOrder,
+    cmProjectDirectoryListGenerator{ gg, this->Names, this->SortOrder,
                                      this->SortDirection };
 
   // PREFIX/(cmake|CMake)/ (useful on windows or in build trees)
@@ -2686,7 +2716,7 @@ bool cmFindPackageCommand::SearchPrefix(std::string const& prefix_in)
   }
 
   auto secondPkgDirGen =
-    cmProjectDirectoryListGenerator{ this->Names, this->SortOrder,
+    cmProjectDirectoryListGenerator{ gg, this->Names, this->SortOrder,
                                      this->SortDirection };
 
   // PREFIX/(Foo|foo|FOO).*/(cmake|CMake)/(Foo|foo|FOO).*/
@@ -2760,10 +2790,11 @@ bool cmFindPackageCommand::SearchFrameworkPrefix(std::string const& prefix_in)
   auto searchFn = [this](const std::string& fullPath) -> bool {
     return this->SearchDirectory(fullPath);
   };
+  cmGlobalGenerator* const gg = this->Makefile->GetGlobalGenerator();
 
-  auto iCMakeGen = cmCaseInsensitiveDirectoryListGenerator{ "cmake"_s };
+  auto iCMakeGen = cmCaseInsensitiveDirectoryListGenerator{ gg, "cmake"_s };
   auto fwGen =
-    cmMacProjectDirectoryListGenerator{ this->Names, ".framework"_s };
+    cmMacProjectDirectoryListGenerator{ gg, this->Names, ".framework"_s };
   auto rGen = cmAppendPathSegmentGenerator{ "Resources"_s };
   auto vGen = cmAppendPathSegmentGenerator{ "Versions"_s };
   auto grGen = cmFileListGeneratorGlob{ "/*/Resources"_s };
@@ -2798,8 +2829,10 @@ bool cmFindPackageCommand::SearchAppBundlePrefix(std::string const& prefix_in)
   auto searchFn = [this](const std::string& fullPath) -> bool {
     return this->SearchDirectory(fullPath);
   };
+  cmGlobalGenerator* const gg = this->Makefile->GetGlobalGenerator();
 
-  auto appGen = cmMacProjectDirectoryListGenerator{ this->Names, ".app"_s };
+  auto appGen =
+    cmMacProjectDirectoryListGenerator{ gg, this->Names, ".app"_s };
   auto crGen = cmAppendPathSegmentGenerator{ "Contents/Resources"_s };
 
   // <prefix>/Foo.app/Contents/Resources
@@ -2810,7 +2843,7 @@ bool cmFindPackageCommand::SearchAppBundlePrefix(std::string const& prefix_in)
   // <prefix>/Foo.app/Contents/Resources/CMake
   return TryGeneratedPaths(
     searchFn, prefix, appGen, crGen,
-    cmCaseInsensitiveDirectoryListGenerator{ "cmake"_s });
+    cmCaseInsensitiveDirectoryListGenerator{ gg, "cmake"_s });
 }
 
 // TODO: Debug cmsys::Glob double slash problem.
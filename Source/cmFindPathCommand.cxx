@@ -42,6 +42,9 @@ bool cmFindPathCommand::InitialPass(std::vector<std::string> const& argsIn)
     return true;
   }
 
+#if !defined(CMAKE_BOOTSTRAP)
+  auto profilingRAII = this->CreateSearchProfilingEntry();
+#endif
   std::string result = this->FindHeader();
   this->StoreFindResult(result);
   return true;
@@ -205,6 +205,9 @@ bool cmFindProgramCommand::InitialPass(std::vector<std::string> const& argsIn)
     return true;
   }
 
+#if !defined(CMAKE_BOOTSTRAP)
+  auto profilingRAII = this->CreateSearchProfilingEntry();
+#endif
   std::string const result = this->FindProgram();
   this->StoreFindResult(result);
   return true;
@@ -55,6 +55,15 @@ public:
   }
   void SetZipLists() { this->ZipLists = true; }
 
+  void AddList(std::string const& value)
+  {
+    if (!value.empty()) {
+      this->Args.push_back(value);
+      this->ListArgs.resize(this->Args.size());
+      this->ListArgs.back() = true;
+    }
+  }
+
   std::vector<std::string> Args;
 
 private:
@@ -76,6 +85,8 @@ private:
   cmMakefile* Makefile;
   std::size_t IterationVarsCount = 0u;
   bool ZipLists = false;
+  // Whether each of the Args is the value of a list to iterate over.
+  std::vector<bool> ListArgs;
 };
 
 cmForEachFunctionBlocker::cmForEachFunctionBlocker(cmMakefile* mf)
@@ -124,13 +135,25 @@ bool cmForEachFunctionBlocker::ReplayItems(
   }
 
   auto restore = false;
-  for (std::string const& arg : cmMakeRange(this->Args).advance(1)) {
+  auto iterate = [&](cm::string_view item) -> bool {
     // Set the variable to the loop value
-    mf.AddDefinition(this->Args.front(), arg);
+    mf.AddDefinition(this->Args.front(), item);
     // Invoke all the functions that were collected in the block.
     auto r = this->invoke(functions, inStatus, mf);
     restore = r.Restore;
-    if (r.Break) {
+    return !r.Break;
+  };
+  this->ListArgs.resize(this->Args.size());
+  for (std::size_t i = 1; i < this->Args.size(); ++i) {
+    if (!this->ListArgs[i]) {
+      if (!iterate(this->Args[i])) {
+        break;
+      }
+      continue;
+    }
+    // Walk the list elements in place instead of copying each of them.
+    cmListView const items(this->Args[i], cmList::EmptyElements::Yes);
+    if (!std::all_of(items.begin(), items.end(), iterate)) {
       break;
     }
   }
@@ -156,20 +179,22 @@ bool cmForEachFunctionBlocker::ReplayZipLists(
 
   auto& mf = inStatus.GetMakefile();
 
-  // Expand the list of list-variables into a list of lists of strings
-  std::vector<cmList> values;
-  values.reserve(this->Args.size() - this->IterationVarsCount);
-  // Also track the longest list size
-  std::size_t maxItems = 0u;
+  // Copy the values of the list-variables, whose elements are then
+  // visited in place
+  std::vector<std::string> lists;
+  lists.reserve(this->Args.size() - this->IterationVarsCount);
   for (auto const& var :
        cmMakeRange(this->Args).advance(this->IterationVarsCount)) {
-    cmList items;
-    auto const& value = mf.GetSafeDefinition(var);
-    if (!value.empty()) {
-      items.assign(value, cmList::EmptyElements::Yes);
-    }
-    maxItems = std::max(maxItems, items.size());
-    values.emplace_back(std::move(items));
+    lists.push_back(mf.GetSafeDefinition(var));
+  }
+  std::vector<cmListView> values;
+  values.reserve(lists.size());
+  // Also track the longest list size
+  std::size_t maxItems = 0u;
+  for (auto const& value : lists) {
+    values.emplace_back(value, value.empty() ? cmList::EmptyElements::No
+                                             : cmList::EmptyElements::Yes);
+    maxItems = std::max(maxItems, values.back().size());
   }
 
   // Form the list of iteration variables
@@ -207,13 +232,13 @@ bool cmForEachFunctionBlocker::ReplayZipLists(
     }
   }
 
-  // Form a vector of current positions in all lists (Ok, vectors) of values
-  std::vector<decltype(values)::value_type::iterator> positions;
+  // Form a vector of current positions in all lists of values
+  std::vector<cmListView::const_iterator> positions;
   positions.reserve(values.size());
   std::transform(
     values.begin(), values.end(), std::back_inserter(positions),
     // Set the initial position to the beginning of every list
-    [](decltype(values)::value_type& list) { return list.begin(); });
+    [](cmListView const& list) { return list.begin(); });
   assert("Sanity check" && positions.size() == values.size());
 
   auto restore = false;
@@ -348,10 +373,7 @@ bool HandleInMode(std::vector<std::string> const& args,
       fb->SetZipLists();
 
     } else if (doing == DoingLists) {
-      auto const& value = makefile.GetSafeDefinition(arg);
-      if (!value.empty()) {
-        cmExpandList(value, fb->Args, cmList::EmptyElements::Yes);
-      }
+      fb->AddList(makefile.GetSafeDefinition(arg));
 
     } else if (doing == DoingItems || doing == DoingZipLists) {
       fb->Args.push_back(arg);
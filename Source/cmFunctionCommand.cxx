@@ -11,6 +11,7 @@
 
 #include "cmExecutionStatus.h"
 #include "cmFunctionBlocker.h"
+#include "cmInternedString.h"
 #include "cmList.h"
 #include "cmListFileCache.h"
 #include "cmMakefile.h"
@@ -46,7 +47,7 @@ public:
   std::vector<std::string> Args;
   std::vector<cmListFileFunction> Functions;
   cmPolicies::PolicyMap Policies;
-  std::string FilePath;
+  cmInternedString FilePath;
   long Line;
 };
 
@@ -100,7 +101,8 @@ bool cmFunctionHelperCommand::operator()(
 
   makefile.AddDefinition(CMAKE_CURRENT_FUNCTION, this->Args.front());
   makefile.MarkVariableAsUsed(CMAKE_CURRENT_FUNCTION);
-  makefile.AddDefinition(CMAKE_CURRENT_FUNCTION_LIST_FILE, this->FilePath);
+  makefile.AddDefinition(CMAKE_CURRENT_FUNCTION_LIST_FILE,
+                         this->FilePath.str());
   makefile.MarkVariableAsUsed(CMAKE_CURRENT_FUNCTION_LIST_FILE);
   makefile.AddDefinition(CMAKE_CURRENT_FUNCTION_LIST_DIR,
                          cmSystemTools::GetFilenamePath(this->FilePath));
@@ -14,6 +14,7 @@
 #include "cmGeneratorExpressionEvaluator.h"
 #include "cmGeneratorExpressionLexer.h"
 #include "cmGeneratorExpressionParser.h"
+#include "cmGeneratorTarget.h"
 #include "cmList.h"
 #include "cmLocalGenerator.h"
 #include "cmStringAlgorithms.h"
@@ -70,13 +71,21 @@ const std::string& cmCompiledGeneratorExpression::Evaluate(
     currentTarget ? currentTarget : headTarget, this->EvaluateForBuildsystem,
     this->Backtrace, language);
 
-  if (!this->NeedsEvaluation) {
-    return this->Input;
+  if (!this->Tree->NeedsEvaluation) {
+    return this->Tree->Input;
+  }
+
+  // $<CONFIG:...> maps the configurations of imported targets, so
+  // evaluations for them are not memoized.
+  bool const memoize =
+    !context.CurrentTarget || !context.CurrentTarget->IsImported();
+  if (memoize && this->EvaluateMemoized(lg, config)) {
+    return this->Output;
   }
 
   this->Output.clear();
 
-  for (const auto& it : this->Evaluators) {
+  for (const auto& it : this->Tree->Evaluators) {
     this->Output += it->Evaluate(&context, dagChecker);
 
     this->SeenTargetProperties.insert(context.SeenTargetProperties.cbegin(),
@@ -99,19 +108,71 @@ const std::string& cmCompiledGeneratorExpression::Evaluate(
 
   this->DependTargets = context.DependTargets;
   this->AllTargetsSeen = context.AllTargets;
+
+  if (memoize && !context.HadError && !context.HadUnmemoizableCondition &&
+      !context.HadHeadSensitiveCondition &&
+      !context.HadLinkLanguageSensitiveCondition) {
+#ifndef CMAKE_BOOTSTRAP
+    // Count as misses only the evaluations that could have been memoized.
+    cmake* cm = lg->GetCMakeInstance();
+    if (cm->IsProfilingEnabled()) {
+      cm->GetProfilingOutput().IncrementCounter("genex_memo", "misses");
+    }
+#endif
+    if (context.HadContextSensitiveCondition) {
+      this->Tree->ConfigResults.emplace(config, this->Output);
+    } else {
+      this->Tree->Result = this->Output;
+    }
+  }
   return this->Output;
 }
 
-cmCompiledGeneratorExpression::cmCompiledGeneratorExpression(
-  cmake& cmakeInstance, cmListFileBacktrace backtrace, std::string input)
-  : Backtrace(std::move(backtrace))
-  , Input(std::move(input))
+bool cmCompiledGeneratorExpression::EvaluateMemoized(
+  cmLocalGenerator* lg, std::string const& config) const
 {
+  std::string const* result = nullptr;
+  bool contextSensitive = false;
+  if (this->Tree->Result) {
+    result = &*this->Tree->Result;
+  } else {
+    auto it = this->Tree->ConfigResults.find(config);
+    if (it != this->Tree->ConfigResults.end()) {
+      result = &it->second;
+      contextSensitive = true;
+    }
+  }
+
+  if (!result) {
+    return false;
+  }
+
 #ifndef CMAKE_BOOTSTRAP
-  auto profilingRAII =
-    cmakeInstance.CreateProfilingEntry("genex_compile", this->Input);
+  cmake* cm = lg->GetCMakeInstance();
+  if (cm->IsProfilingEnabled()) {
+    cm->GetProfilingOutput().IncrementCounter("genex_memo", "hits");
+  }
+#else
+  static_cast<void>(lg);
 #endif
 
+  // A memoized evaluation used no targets, so only the configuration
+  // sensitivity is carried over.
+  this->Output = *result;
+  this->DependTargets.clear();
+  this->AllTargetsSeen.clear();
+  this->MaxLanguageStandard.clear();
+  this->HadContextSensitiveCondition = contextSensitive;
+  this->HadHeadSensitiveCondition = false;
+  this->HadLinkLanguageSensitiveCondition = false;
+  this->SourceSensitiveTargets.clear();
+  return true;
+}
+
+cmGeneratorExpressionParseTree::cmGeneratorExpressionParseTree(
+  std::string input)
+  : Input(std::move(input))
+{
   cmGeneratorExpressionLexer l;
   std::vector<cmGeneratorExpressionToken> tokens = l.Tokenize(this->Input);
   this->NeedsEvaluation = l.GetSawGeneratorExpression();
@@ -122,6 +183,38 @@ cmCompiledGeneratorExpression::cmCompiledGeneratorExpression(
   }
 }
 
+cmGeneratorExpressionParseTree::~cmGeneratorExpressionParseTree() = default;
+
+cmCompiledGeneratorExpression::cmCompiledGeneratorExpression(
+  cmake& cmakeInstance, cmListFileBacktrace backtrace, std::string input)
+  : Backtrace(std::move(backtrace))
+{
+  // Plain strings are cheap to lex and common, so only share the parse
+  // trees of actual generator expressions.
+  if (cmGeneratorExpression::Find(input) == std::string::npos) {
+    this->Tree =
+      std::make_shared<cmGeneratorExpressionParseTree>(std::move(input));
+    return;
+  }
+
+  cmake::GeneratorExpressionParseTreeMap& trees =
+    cmakeInstance.GetGeneratorExpressionParseTrees();
+  auto it = trees.find(input);
+  if (it != trees.end()) {
+    this->Tree = it->second;
+    return;
+  }
+
+#ifndef CMAKE_BOOTSTRAP
+  auto profilingRAII =
+    cmakeInstance.CreateProfilingEntry("genex_compile", input);
+#endif
+
+  this->Tree =
+    std::make_shared<cmGeneratorExpressionParseTree>(std::move(input));
+  trees.emplace(this->Tree->Input, this->Tree);
+}
+
 std::string cmGeneratorExpression::StripEmptyListElements(
   const std::string& input)
 {
@@ -11,6 +11,8 @@
 #include <utility>
 #include <vector>
 
+#include <cm/optional>
+
 #include "cmListFileCache.h"
 #include "cmLocalGenerator.h"
 
@@ -87,6 +89,34 @@ private:
   cmListFileBacktrace Backtrace;
 };
 
+/** \class cmGeneratorExpressionParseTree
+ * \brief Parsed form of a generator expression input string.
+ *
+ * A parse tree is not modified by evaluation, so it is shared by all
+ * compiled expressions that have the same input.  The evaluators refer
+ * to the Input buffer, so the tree must not be copied or moved.
+ */
+struct cmGeneratorExpressionParseTree
+{
+  explicit cmGeneratorExpressionParseTree(std::string input);
+  ~cmGeneratorExpressionParseTree();
+
+  cmGeneratorExpressionParseTree(cmGeneratorExpressionParseTree const&) =
+    delete;
+  cmGeneratorExpressionParseTree& operator=(
+    cmGeneratorExpressionParseTree const&) = delete;
+
+  std::string const Input;
+  std::vector<std::unique_ptr<cmGeneratorExpressionEvaluator>> Evaluators;
+  bool NeedsEvaluation;
+
+  // Results of evaluations that used only memoizable nodes: one for an
+  // expression that does not depend on the configuration, or one per
+  // configuration for an expression that does.
+  mutable cm::optional<std::string> Result;
+  mutable std::map<std::string, std::string> ConfigResults;
+};
+
 class cmCompiledGeneratorExpression
 {
 public:
@@ -119,7 +149,7 @@ public:
     return this->AllTargetsSeen;
   }
 
-  std::string const& GetInput() const { return this->Input; }
+  std::string const& GetInput() const { return this->Tree->Input; }
 
   cmListFileBacktrace GetBacktrace() const { return this->Backtrace; }
   bool GetHadContextSensitiveCondition() const
@@ -156,10 +186,10 @@ private:
 
   friend class cmGeneratorExpression;
 
+  bool EvaluateMemoized(cmLocalGenerator* lg, std::string const& config) const;
+
   cmListFileBacktrace Backtrace;
-  std::vector<std::unique_ptr<cmGeneratorExpressionEvaluator>> Evaluators;
-  const std::string Input;
-  bool NeedsEvaluation;
+  std::shared_ptr<cmGeneratorExpressionParseTree const> Tree;
   bool EvaluateForBuildsystem = false;
   bool Quiet = false;
 
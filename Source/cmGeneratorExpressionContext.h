@@ -40,5 +40,6 @@ struct cmGeneratorExpressionContext
   bool HadContextSensitiveCondition = false;
   bool HadHeadSensitiveCondition = false;
   bool HadLinkLanguageSensitiveCondition = false;
+  bool HadUnmemoizableCondition = false;
   bool EvaluateForBuildsystem;
 };
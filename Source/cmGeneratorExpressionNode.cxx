@@ -78,7 +78,10 @@ std::string cmGeneratorExpressionNode::EvaluateDependentExpression(
 
 static const struct ZeroNode : public cmGeneratorExpressionNode
 {
-  ZeroNode() {} // NOLINT(modernize-use-equals-default)
+  ZeroNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   bool GeneratesContent() const override { return false; }
 
@@ -96,7 +99,10 @@ static const struct ZeroNode : public cmGeneratorExpressionNode
 
 static const struct OneNode : public cmGeneratorExpressionNode
 {
-  OneNode() {} // NOLINT(modernize-use-equals-default)
+  OneNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   bool AcceptsArbitraryContentParameter() const override { return true; }
 
@@ -120,7 +126,8 @@ struct BooleanOpNode : public cmGeneratorExpressionNode
 {
   BooleanOpNode(const char* op_, const char* successVal_,
                 const char* failureVal_)
-    : op(op_)
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+    , op(op_)
     , successVal(successVal_)
     , failureVal(failureVal_)
   {
@@ -165,7 +172,10 @@ static const BooleanOpNode andNode("AND", "1", "0"), orNode("OR", "0", "1");
 
 static const struct NotNode : public cmGeneratorExpressionNode
 {
-  NotNode() {} // NOLINT(modernize-use-equals-default)
+  NotNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   std::string Evaluate(
     const std::vector<std::string>& parameters,
@@ -185,7 +195,10 @@ static const struct NotNode : public cmGeneratorExpressionNode
 
 static const struct BoolNode : public cmGeneratorExpressionNode
 {
-  BoolNode() {} // NOLINT(modernize-use-equals-default)
+  BoolNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 1; }
 
@@ -201,7 +214,10 @@ static const struct BoolNode : public cmGeneratorExpressionNode
 
 static const struct IfNode : public cmGeneratorExpressionNode
 {
-  IfNode() {} // NOLINT(modernize-use-equals-default)
+  IfNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 3; }
 
@@ -229,7 +245,10 @@ static const struct IfNode : public cmGeneratorExpressionNode
 
 static const struct StrEqualNode : public cmGeneratorExpressionNode
 {
-  StrEqualNode() {} // NOLINT(modernize-use-equals-default)
+  StrEqualNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 2; }
 
@@ -245,7 +264,10 @@ static const struct StrEqualNode : public cmGeneratorExpressionNode
 
 static const struct EqualNode : public cmGeneratorExpressionNode
 {
-  EqualNode() {} // NOLINT(modernize-use-equals-default)
+  EqualNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 2; }
 
@@ -346,7 +368,10 @@ static const struct InListNode : public cmGeneratorExpressionNode
 
 static const struct FilterNode : public cmGeneratorExpressionNode
 {
-  FilterNode() {} // NOLINT(modernize-use-equals-default)
+  FilterNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 3; }
 
@@ -385,7 +410,10 @@ static const struct FilterNode : public cmGeneratorExpressionNode
 
 static const struct RemoveDuplicatesNode : public cmGeneratorExpressionNode
 {
-  RemoveDuplicatesNode() {} // NOLINT(modernize-use-equals-default)
+  RemoveDuplicatesNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 1; }
 
@@ -584,7 +612,10 @@ static const struct GenexEvalNode : public GenexEvaluator
 
 static const struct LowerCaseNode : public cmGeneratorExpressionNode
 {
-  LowerCaseNode() {} // NOLINT(modernize-use-equals-default)
+  LowerCaseNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   bool AcceptsArbitraryContentParameter() const override { return true; }
 
@@ -600,7 +631,10 @@ static const struct LowerCaseNode : public cmGeneratorExpressionNode
 
 static const struct UpperCaseNode : public cmGeneratorExpressionNode
 {
-  UpperCaseNode() {} // NOLINT(modernize-use-equals-default)
+  UpperCaseNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   bool AcceptsArbitraryContentParameter() const override { return true; }
 
@@ -713,7 +747,10 @@ std::string ToString(bool isTrue)
 
 static const struct PathNode : public cmGeneratorExpressionNode
 {
-  PathNode() {} // NOLINT(modernize-use-equals-default)
+  PathNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return TwoOrMoreParameters; }
 
@@ -1140,7 +1177,10 @@ static const struct PathNode : public cmGeneratorExpressionNode
 
 static const struct PathEqualNode : public cmGeneratorExpressionNode
 {
-  PathEqualNode() {} // NOLINT(modernize-use-equals-default)
+  PathEqualNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 2; }
 
@@ -1227,7 +1267,10 @@ bool GetNumericArguments(
 
 static const struct ListNode : public cmGeneratorExpressionNode
 {
-  ListNode() {} // NOLINT(modernize-use-equals-default)
+  ListNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return TwoOrMoreParameters; }
 
@@ -1828,7 +1871,10 @@ static const struct ListNode : public cmGeneratorExpressionNode
 
 static const struct MakeCIdentifierNode : public cmGeneratorExpressionNode
 {
-  MakeCIdentifierNode() {} // NOLINT(modernize-use-equals-default)
+  MakeCIdentifierNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   bool AcceptsArbitraryContentParameter() const override { return true; }
 
@@ -1845,7 +1891,10 @@ static const struct MakeCIdentifierNode : public cmGeneratorExpressionNode
 template <char C>
 struct CharacterNode : public cmGeneratorExpressionNode
 {
-  CharacterNode() {} // NOLINT(modernize-use-equals-default)
+  CharacterNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 0; }
 
@@ -2118,7 +2167,10 @@ static struct PlatformIdNode platformIdNode;
 template <cmSystemTools::CompareOp Op>
 struct VersionNode : public cmGeneratorExpressionNode
 {
-  VersionNode() {} // NOLINT(modernize-use-equals-default)
+  VersionNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 2; }
 
@@ -2186,7 +2238,10 @@ static const struct LinkOnlyNode : public cmGeneratorExpressionNode
 
 static const struct ConfigurationNode : public cmGeneratorExpressionNode
 {
-  ConfigurationNode() {} // NOLINT(modernize-use-equals-default)
+  ConfigurationNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 0; }
 
@@ -2203,7 +2258,10 @@ static const struct ConfigurationNode : public cmGeneratorExpressionNode
 
 static const struct ConfigurationTestNode : public cmGeneratorExpressionNode
 {
-  ConfigurationTestNode() {} // NOLINT(modernize-use-equals-default)
+  ConfigurationTestNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return ZeroOrMoreParameters; }
 
@@ -2239,6 +2297,7 @@ static const struct ConfigurationTestNode : public cmGeneratorExpressionNode
         /* clang-format on */
         context->LG->GetCMakeInstance()->IssueMessage(
           MessageType::WARNING, e.str(), context->Backtrace);
+        context->HadUnmemoizableCondition = true;
       }
 
       firstParam = false;
@@ -2289,7 +2348,10 @@ static const struct ConfigurationTestNode : public cmGeneratorExpressionNode
 
 static const struct JoinNode : public cmGeneratorExpressionNode
 {
-  JoinNode() {} // NOLINT(modernize-use-equals-default)
+  JoinNode()
+    : cmGeneratorExpressionNode(Memoization::Allowed)
+  {
+  }
 
   int NumExpectedParameters() const override { return 2; }
 
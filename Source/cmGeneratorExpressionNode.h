@@ -23,6 +23,20 @@ struct cmGeneratorExpressionNode
     ZeroOrMoreParameters = -3,
     OneOrZeroParameters = -4
   };
+
+  // Whether the result of a node depends only on its parameters and the
+  // configuration, so that evaluations using it may be memoized.
+  enum class Memoization
+  {
+    Never,
+    Allowed
+  };
+
+  cmGeneratorExpressionNode() = default;
+  explicit cmGeneratorExpressionNode(Memoization memoization)
+    : Memoizable(memoization == Memoization::Allowed)
+  {
+  }
   virtual ~cmGeneratorExpressionNode() = default;
 
   virtual bool GeneratesContent() const { return true; }
@@ -31,6 +45,8 @@ struct cmGeneratorExpressionNode
 
   virtual bool AcceptsArbitraryContentParameter() const { return false; }
 
+  bool IsMemoizable() const { return this->Memoizable; }
+
   virtual int NumExpectedParameters() const { return 1; }
 
   virtual bool ShouldEvaluateNextParameter(const std::vector<std::string>&,
@@ -53,6 +69,9 @@ struct cmGeneratorExpressionNode
 
   static const cmGeneratorExpressionNode* GetNode(
     const std::string& identifier);
+
+private:
+  bool Memoizable = false;
 };
 
 void reportError(cmGeneratorExpressionContext* context,
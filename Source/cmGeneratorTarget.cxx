@@ -531,6 +531,8 @@ void cmGeneratorTarget::ClearLinkInterfaceCache()
 {
   this->LinkInterfaceMap.clear();
   this->LinkInterfaceUsageRequirementsOnlyMap.clear();
+  this->LinkInterfaceClosureForLinkMap.clear();
+  this->LinkInterfaceClosureForUsageMap.clear();
 }
 
 void cmGeneratorTarget::AddSourceCommon(const std::string& src, bool before)
@@ -3706,7 +3708,7 @@ void cmGeneratorTarget::ReportPropertyOrigin(
   const std::string& p, const std::string& result, const std::string& report,
   const std::string& compatibilityType) const
 {
-  cmList debugProperties{ this->Target->GetMakefile()->GetDefinition(
+  cmListView debugProperties{ this->Target->GetMakefile()->GetDefinition(
     "CMAKE_DEBUG_TARGET_PROPERTIES") };
   bool debugOrigin = !this->DebugCompatiblePropertiesDone[p] &&
     cm::contains(debugProperties, p);
@@ -577,13 +577,13 @@ private:
 
 public:
   /** Get the include directories for this target.  */
-  std::vector<BT<std::string>> GetIncludeDirectories(
+  std::vector<BT<std::string>> const& GetIncludeDirectories(
     const std::string& config, const std::string& lang) const;
 
   void GetCompileOptions(std::vector<std::string>& result,
                          const std::string& config,
                          const std::string& language) const;
-  std::vector<BT<std::string>> GetCompileOptions(
+  std::vector<BT<std::string>> const& GetCompileOptions(
     std::string const& config, std::string const& language) const;
 
   void GetCompileFeatures(std::vector<std::string>& features,
@@ -594,13 +594,13 @@ public:
   void GetCompileDefinitions(std::vector<std::string>& result,
                              const std::string& config,
                              const std::string& language) const;
-  std::vector<BT<std::string>> GetCompileDefinitions(
+  std::vector<BT<std::string>> const& GetCompileDefinitions(
     std::string const& config, std::string const& language) const;
 
   void GetLinkOptions(std::vector<std::string>& result,
                       const std::string& config,
                       const std::string& language) const;
-  std::vector<BT<std::string>> GetLinkOptions(
+  std::vector<BT<std::string>> const& GetLinkOptions(
     std::string const& config, std::string const& language) const;
 
   std::vector<BT<std::string>>& ResolveLinkerWrapper(
@@ -616,7 +616,7 @@ public:
   void GetLinkDirectories(std::vector<std::string>& result,
                           const std::string& config,
                           const std::string& language) const;
-  std::vector<BT<std::string>> GetLinkDirectories(
+  std::vector<BT<std::string>> const& GetLinkDirectories(
     std::string const& config, std::string const& language) const;
 
   void GetLinkDepends(std::vector<std::string>& result,
@@ -625,7 +625,7 @@ public:
   std::vector<BT<std::string>> GetLinkDepends(
     std::string const& config, std::string const& language) const;
 
-  std::vector<BT<std::string>> GetPrecompileHeaders(
+  std::vector<BT<std::string>> const& GetPrecompileHeaders(
     const std::string& config, const std::string& language) const;
 
   std::vector<std::string> GetPchArchs(std::string const& config,
@@ -1147,6 +1147,17 @@ private:
   mutable std::map<std::string, LinkImplClosure> LinkImplClosureForLinkMap;
   mutable std::map<std::string, LinkImplClosure> LinkImplClosureForUsageMap;
 
+  struct LinkInterfaceClosure : public std::vector<cmGeneratorTarget const*>
+  {
+    bool Computing = false;
+    bool Done = false;
+    bool HeadIndependent = false;
+  };
+  mutable std::map<std::string, LinkInterfaceClosure>
+    LinkInterfaceClosureForLinkMap;
+  mutable std::map<std::string, LinkInterfaceClosure>
+    LinkInterfaceClosureForUsageMap;
+
   using LinkInterfaceMapType = std::map<std::string, cmHeadToLinkInterfaceMap>;
   mutable LinkInterfaceMapType LinkInterfaceMap;
   mutable LinkInterfaceMapType LinkInterfaceUsageRequirementsOnlyMap;
@@ -1373,6 +1384,13 @@ public:
   const std::vector<const cmGeneratorTarget*>& GetLinkImplementationClosure(
     const std::string& config, UseTo usage) const;
 
+  // The closure of the link interface when it is the same for every head
+  // target, or null when it depends on the head target or on a cycle.
+  std::vector<cmGeneratorTarget const*> const*
+  GetHeadIndependentLinkInterfaceClosure(std::string const& config,
+                                         cmGeneratorTarget const* headTarget,
+                                         UseTo usage) const;
+
   mutable std::map<std::string, std::string> MaxLanguageStandards;
   std::map<std::string, std::string> const& GetMaxLanguageStandards() const
   {
@@ -244,7 +244,7 @@ void processIncludeDirectories(cmGeneratorTarget const* tgt,
 }
 }
 
-std::vector<BT<std::string>> cmGeneratorTarget::GetIncludeDirectories(
+std::vector<BT<std::string>> const& cmGeneratorTarget::GetIncludeDirectories(
   const std::string& config, const std::string& lang) const
 {
   ConfigAndLanguage cacheKey(config, lang);
@@ -261,7 +261,7 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetIncludeDirectories(
                                              nullptr, nullptr,
                                              this->LocalGenerator, config);
 
-  cmList debugProperties{ this->Makefile->GetDefinition(
+  cmListView debugProperties{ this->Makefile->GetDefinition(
     "CMAKE_DEBUG_TARGET_PROPERTIES") };
   bool debugIncludes = !this->DebugIncludesDone &&
     cm::contains(debugProperties, "INCLUDE_DIRECTORIES");
@@ -333,6 +333,8 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetIncludeDirectories(
     }
   }
 
-  this->IncludeDirectoriesCache.emplace(cacheKey, includes);
-  return includes;
+  std::vector<BT<std::string>>& cached =
+    this->IncludeDirectoriesCache[cacheKey];
+  cached = std::move(includes);
+  return cached;
 }
@@ -287,6 +287,16 @@ static void processILibs(const std::string& config,
 {
   if (item.Target && emitted.insert(item.Target).second) {
     tgts.push_back(item.Target);
+    if (std::vector<cmGeneratorTarget const*> const* closure =
+          item.Target->GetHeadIndependentLinkInterfaceClosure(
+            config, headTarget, usage)) {
+      for (cmGeneratorTarget const* tgt : *closure) {
+        if (emitted.insert(tgt).second) {
+          tgts.push_back(tgt);
+        }
+      }
+      return;
+    }
     if (cmLinkInterfaceLibraries const* iface =
           item.Target->GetLinkInterfaceLibraries(config, headTarget, usage)) {
       for (cmLinkItem const& lib : iface->Libraries) {
@@ -313,6 +323,61 @@ cmGeneratorTarget::GetLinkInterfaceClosure(std::string const& config,
   return tgts;
 }
 
+std::vector<cmGeneratorTarget const*> const*
+cmGeneratorTarget::GetHeadIndependentLinkInterfaceClosure(
+  std::string const& config, cmGeneratorTarget const* headTarget,
+  UseTo usage) const
+{
+  LinkInterfaceClosure& tgts =
+    (usage == UseTo::Compile ? this->LinkInterfaceClosureForUsageMap[config]
+                             : this->LinkInterfaceClosureForLinkMap[config]);
+  if (tgts.Done) {
+    return tgts.HeadIndependent ? &tgts : nullptr;
+  }
+  // A target reached again while computing its own closure is on a cycle.
+  // Merging closures is only equivalent to the depth-first walk done by
+  // processILibs when the graph below this target is acyclic.
+  if (tgts.Computing) {
+    return nullptr;
+  }
+  tgts.Computing = true;
+
+  bool headIndependent = true;
+  std::set<cmGeneratorTarget const*> emitted;
+  if (cmLinkInterfaceLibraries const* iface =
+        this->GetLinkInterfaceLibraries(config, headTarget, usage)) {
+    headIndependent = !iface->HadHeadSensitiveCondition;
+    for (auto it = iface->Libraries.begin();
+         headIndependent && it != iface->Libraries.end(); ++it) {
+      cmGeneratorTarget const* dep = it->Target;
+      if (!dep || !emitted.insert(dep).second) {
+        continue;
+      }
+      tgts.push_back(dep);
+      std::vector<cmGeneratorTarget const*> const* closure =
+        dep->GetHeadIndependentLinkInterfaceClosure(config, headTarget, usage);
+      if (!closure) {
+        headIndependent = false;
+        break;
+      }
+      for (cmGeneratorTarget const* tgt : *closure) {
+        if (emitted.insert(tgt).second) {
+          tgts.push_back(tgt);
+        }
+      }
+    }
+  }
+
+  tgts.Computing = false;
+  tgts.Done = true;
+  tgts.HeadIndependent = headIndependent;
+  if (!headIndependent) {
+    tgts.clear();
+    return nullptr;
+  }
+  return &tgts;
+}
+
 const std::vector<const cmGeneratorTarget*>&
 cmGeneratorTarget::GetLinkImplementationClosure(const std::string& config,
                                                 UseTo usage) const
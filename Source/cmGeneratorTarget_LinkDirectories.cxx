@@ -103,15 +103,15 @@ void cmGeneratorTarget::GetLinkDirectories(std::vector<std::string>& result,
                                            const std::string& config,
                                            const std::string& language) const
 {
-  std::vector<BT<std::string>> tmp =
+  std::vector<BT<std::string>> const& tmp =
     this->GetLinkDirectories(config, language);
   result.reserve(tmp.size());
-  for (BT<std::string>& v : tmp) {
-    result.emplace_back(std::move(v.Value));
+  for (BT<std::string> const& v : tmp) {
+    result.emplace_back(v.Value);
   }
 }
 
-std::vector<BT<std::string>> cmGeneratorTarget::GetLinkDirectories(
+std::vector<BT<std::string>> const& cmGeneratorTarget::GetLinkDirectories(
   std::string const& config, std::string const& language) const
 {
   ConfigAndLanguage cacheKey(
@@ -128,7 +128,7 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetLinkDirectories(
   cmGeneratorExpressionDAGChecker dagChecker(
     this, "LINK_DIRECTORIES", nullptr, nullptr, this->LocalGenerator, config);
 
-  cmList debugProperties{ this->Makefile->GetDefinition(
+  cmListView debugProperties{ this->Makefile->GetDefinition(
     "CMAKE_DEBUG_TARGET_PROPERTIES") };
   bool debugDirectories = !this->DebugLinkDirectoriesDone &&
     cm::contains(debugProperties, "LINK_DIRECTORIES");
@@ -149,6 +149,7 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetLinkDirectories(
   processLinkDirectories(this, entries, result, uniqueDirectories,
                          debugDirectories);
 
-  this->LinkDirectoriesCache.emplace(cacheKey, result);
-  return result;
+  std::vector<BT<std::string>>& cached = this->LinkDirectoriesCache[cacheKey];
+  cached = std::move(result);
+  return cached;
 }
@@ -197,14 +197,15 @@ void cmGeneratorTarget::GetCompileOptions(std::vector<std::string>& result,
                                           const std::string& config,
                                           const std::string& language) const
 {
-  std::vector<BT<std::string>> tmp = this->GetCompileOptions(config, language);
+  std::vector<BT<std::string>> const& tmp =
+    this->GetCompileOptions(config, language);
   result.reserve(tmp.size());
-  for (BT<std::string>& v : tmp) {
-    result.emplace_back(std::move(v.Value));
+  for (BT<std::string> const& v : tmp) {
+    result.emplace_back(v.Value);
   }
 }
 
-std::vector<BT<std::string>> cmGeneratorTarget::GetCompileOptions(
+std::vector<BT<std::string>> const& cmGeneratorTarget::GetCompileOptions(
   std::string const& config, std::string const& language) const
 {
   ConfigAndLanguage cacheKey(config, language);
@@ -220,7 +221,7 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetCompileOptions(
   cmGeneratorExpressionDAGChecker dagChecker(
     this, "COMPILE_OPTIONS", nullptr, nullptr, this->LocalGenerator, config);
 
-  cmList debugProperties{ this->Makefile->GetDefinition(
+  cmListView debugProperties{ this->Makefile->GetDefinition(
     "CMAKE_DEBUG_TARGET_PROPERTIES") };
   bool debugOptions = !this->DebugCompileOptionsDone &&
     cm::contains(debugProperties, "COMPILE_OPTIONS");
@@ -238,8 +239,9 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetCompileOptions(
   processOptions(this, entries, result, uniqueOptions, debugOptions,
                  "compile options", OptionsParse::Shell);
 
-  CompileOptionsCache.emplace(cacheKey, result);
-  return result;
+  std::vector<BT<std::string>>& cached = this->CompileOptionsCache[cacheKey];
+  cached = std::move(result);
+  return cached;
 }
 
 void cmGeneratorTarget::GetCompileFeatures(std::vector<std::string>& result,
@@ -261,7 +263,7 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetCompileFeatures(
   cmGeneratorExpressionDAGChecker dagChecker(
     this, "COMPILE_FEATURES", nullptr, nullptr, this->LocalGenerator, config);
 
-  cmList debugProperties{ this->Makefile->GetDefinition(
+  cmListView debugProperties{ this->Makefile->GetDefinition(
     "CMAKE_DEBUG_TARGET_PROPERTIES") };
   bool debugFeatures = !this->DebugCompileFeaturesDone &&
     cm::contains(debugProperties, "COMPILE_FEATURES");
@@ -287,15 +289,15 @@ void cmGeneratorTarget::GetCompileDefinitions(
   std::vector<std::string>& result, const std::string& config,
   const std::string& language) const
 {
-  std::vector<BT<std::string>> tmp =
+  std::vector<BT<std::string>> const& tmp =
     this->GetCompileDefinitions(config, language);
   result.reserve(tmp.size());
-  for (BT<std::string>& v : tmp) {
-    result.emplace_back(std::move(v.Value));
+  for (BT<std::string> const& v : tmp) {
+    result.emplace_back(v.Value);
   }
 }
 
-std::vector<BT<std::string>> cmGeneratorTarget::GetCompileDefinitions(
+std::vector<BT<std::string>> const& cmGeneratorTarget::GetCompileDefinitions(
   std::string const& config, std::string const& language) const
 {
   ConfigAndLanguage cacheKey(config, language);
@@ -312,7 +314,7 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetCompileDefinitions(
                                              nullptr, nullptr,
                                              this->LocalGenerator, config);
 
-  cmList debugProperties{ this->Makefile->GetDefinition(
+  cmListView debugProperties{ this->Makefile->GetDefinition(
     "CMAKE_DEBUG_TARGET_PROPERTIES") };
   bool debugDefines = !this->DebugCompileDefinitionsDone &&
     cm::contains(debugProperties, "COMPILE_DEFINITIONS");
@@ -357,11 +359,13 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetCompileDefinitions(
   processOptions(this, entries, list, uniqueOptions, debugDefines,
                  "compile definitions", OptionsParse::None);
 
-  this->CompileDefinitionsCache.emplace(cacheKey, list);
-  return list;
+  std::vector<BT<std::string>>& cached =
+    this->CompileDefinitionsCache[cacheKey];
+  cached = std::move(list);
+  return cached;
 }
 
-std::vector<BT<std::string>> cmGeneratorTarget::GetPrecompileHeaders(
+std::vector<BT<std::string>> const& cmGeneratorTarget::GetPrecompileHeaders(
   const std::string& config, const std::string& language) const
 {
   ConfigAndLanguage cacheKey(config, language);
@@ -377,7 +381,7 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetPrecompileHeaders(
                                              nullptr, nullptr,
                                              this->LocalGenerator, config);
 
-  cmList debugProperties{ this->Makefile->GetDefinition(
+  cmListView debugProperties{ this->Makefile->GetDefinition(
     "CMAKE_DEBUG_TARGET_PROPERTIES") };
   bool debugDefines = !this->DebugPrecompileHeadersDone &&
     std::find(debugProperties.begin(), debugProperties.end(),
@@ -397,8 +401,10 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetPrecompileHeaders(
   processOptions(this, entries, list, uniqueOptions, debugDefines,
                  "precompile headers", OptionsParse::None);
 
-  this->PrecompileHeadersCache.emplace(cacheKey, list);
-  return list;
+  std::vector<BT<std::string>>& cached =
+    this->PrecompileHeadersCache[cacheKey];
+  cached = std::move(list);
+  return cached;
 }
 
 void cmGeneratorTarget::GetLinkOptions(std::vector<std::string>& result,
@@ -411,14 +417,15 @@ void cmGeneratorTarget::GetLinkOptions(std::vector<std::string>& result,
     return;
   }
 
-  std::vector<BT<std::string>> tmp = this->GetLinkOptions(config, language);
+  std::vector<BT<std::string>> const& tmp =
+    this->GetLinkOptions(config, language);
   result.reserve(tmp.size());
-  for (BT<std::string>& v : tmp) {
-    result.emplace_back(std::move(v.Value));
+  for (BT<std::string> const& v : tmp) {
+    result.emplace_back(v.Value);
   }
 }
 
-std::vector<BT<std::string>> cmGeneratorTarget::GetLinkOptions(
+std::vector<BT<std::string>> const& cmGeneratorTarget::GetLinkOptions(
   std::string const& config, std::string const& language) const
 {
   ConfigAndLanguage cacheKey(
@@ -435,7 +442,7 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetLinkOptions(
   cmGeneratorExpressionDAGChecker dagChecker(
     this, "LINK_OPTIONS", nullptr, nullptr, this->LocalGenerator, config);
 
-  cmList debugProperties{ this->Makefile->GetDefinition(
+  cmListView debugProperties{ this->Makefile->GetDefinition(
     "CMAKE_DEBUG_TARGET_PROPERTIES") };
   bool debugOptions = !this->DebugLinkOptionsDone &&
     cm::contains(debugProperties, "LINK_OPTIONS");
@@ -506,8 +513,9 @@ std::vector<BT<std::string>> cmGeneratorTarget::GetLinkOptions(
   // actual linker wrapper
   result = this->ResolveLinkerWrapper(result, language);
 
-  this->LinkOptionsCache.emplace(cacheKey, result);
-  return result;
+  std::vector<BT<std::string>>& cached = this->LinkOptionsCache[cacheKey];
+  cached = std::move(result);
+  return cached;
 }
 
 std::vector<BT<std::string>>& cmGeneratorTarget::ResolveLinkerWrapper(
@@ -587,11 +595,11 @@ void cmGeneratorTarget::GetStaticLibraryLinkOptions(
   std::vector<std::string>& result, const std::string& config,
   const std::string& language) const
 {
-  std::vector<BT<std::string>> tmp =
+  std::vector<BT<std::string>> const& tmp =
     this->GetStaticLibraryLinkOptions(config, language);
   result.reserve(tmp.size());
-  for (BT<std::string>& v : tmp) {
-    result.emplace_back(std::move(v.Value));
+  for (BT<std::string> const& v : tmp) {
+    result.emplace_back(v.Value);
   }
 }
 
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -35,6 +36,7 @@
 #include "cmDuration.h"
 #include "cmExportBuildFileGenerator.h"
 #include "cmExternalMakefileProjectGenerator.h"
+#include "cmFileTime.h"
 #include "cmGeneratedFileStream.h"
 #include "cmGeneratorExpression.h"
 #include "cmGeneratorTarget.h"
@@ -65,6 +67,7 @@
 #  include <cm3p/json/value.h>
 #  include <cm3p/json/writer.h>
 
+#  include "cmMakefileProfilingData.h"
 #  include "cmQtAutoGenGlobalInitializer.h"
 #endif
 
@@ -90,6 +93,155 @@ std::string GeneratedMakeCommand::QuotedPrintable() const
 }
 }
 
+namespace {
+/* The compiler information cache stores the CMake<LANG>Compiler.cmake
+   files written by compiler identification under a name derived from a
+   hash of everything the identification depends on: the generator, the
+   target system and toolchain file, the compiler and flags selected by
+   variables or the environment, and the version of CMake.  An entry also
+   records the compiler it describes and is used only while that file is
+   unchanged on disk.  */
+char const CompilerInformationCacheMagic[] = "cmake-compiler-info-cache-1";
+
+class CompilerInformationCache
+{
+public:
+  CompilerInformationCache()
+  {
+    std::string dir;
+    if (cmSystemTools::GetEnv("CMAKE_COMPILER_ID_CACHE_DIR", dir) &&
+        !dir.empty()) {
+      this->Directory = cmSystemTools::CollapseFullPath(dir);
+    }
+  }
+
+  bool IsEnabled() const { return !this->Directory.empty(); }
+
+  std::string ComputeKey(cmMakefile* mf, std::string const& lang,
+                         std::string const& platformInfoDir) const
+  {
+    cmCryptoHash hasher(cmCryptoHash::AlgoSHA256);
+    hasher.Initialize();
+    auto append = [&hasher](cm::string_view value) {
+      std::uint64_t const size = value.size();
+      hasher.Append(&size, sizeof(size));
+      hasher.Append(value);
+    };
+    auto appendFile = [&append](std::string const& path) {
+      std::string content;
+      if (!path.empty()) {
+        cmSystemTools::ReadWholeFile(path, content);
+      }
+      append(content);
+    };
+
+    append(CompilerInformationCacheMagic);
+    append(cmVersion::GetCMakeVersion());
+    append(mf->GetGlobalGenerator()->GetName());
+    append(lang);
+    appendFile(cmStrCat(platformInfoDir, "/CMakeSystem.cmake"));
+    appendFile(mf->GetSafeDefinition("CMAKE_TOOLCHAIN_FILE"));
+
+    for (char const* var :
+         { "CMAKE_GENERATOR_PLATFORM", "CMAKE_GENERATOR_TOOLSET",
+           "CMAKE_GENERATOR_INSTANCE", "CMAKE_MAKE_PROGRAM", "CMAKE_SYSROOT",
+           "CMAKE_SYSROOT_COMPILE", "CMAKE_SYSROOT_LINK", "CMAKE_OSX_SYSROOT",
+           "CMAKE_OSX_ARCHITECTURES", "CMAKE_OSX_DEPLOYMENT_TARGET",
+           "CMAKE_EXE_LINKER_FLAGS", "CMAKE_TRY_COMPILE_CONFIGURATION",
+           "CMAKE_TRY_COMPILE_TARGET_TYPE" }) {
+      append(var);
+      append(mf->GetSafeDefinition(var));
+    }
+    for (char const* suffix :
+         { "_COMPILER", "_FLAGS", "_COMPILER_TARGET",
+           "_COMPILER_EXTERNAL_TOOLCHAIN", "_HOST_COMPILER", "_ARCHITECTURES",
+           "_PLATFORM" }) {
+      std::string const var = cmStrCat("CMAKE_", lang, suffix);
+      append(var);
+      append(mf->GetSafeDefinition(var));
+    }
+
+    // Environment variables consulted by the CMakeDetermine<LANG>Compiler
+    // modules and by the compilers themselves.
+    std::string value;
+    auto appendEnv = [&append, &value](std::string const& var) {
+      append(var);
+      append(cmSystemTools::GetEnv(var, value) ? value : std::string());
+    };
+    for (char const* var :
+         { "PATH", "LDFLAGS", "CC", "CFLAGS", "CXX", "CXXFLAGS", "CUDACXX",
+           "CUDAFLAGS", "CUDAHOSTCXX", "CUDAARCHS", "FC", "FFLAGS", "HIPCXX",
+           "HIPFLAGS", "HIPARCHS", "OBJC", "OBJCFLAGS", "OBJCXX",
+           "OBJCXXFLAGS", "ISPC", "ISPCFLAGS", "SWIFTC", "RC", "RCFLAGS",
+           "INCLUDE", "LIB", "LIBPATH", "SDKROOT", "DEVELOPER_DIR",
+           "MACOSX_DEPLOYMENT_TARGET" }) {
+      appendEnv(var);
+    }
+    appendEnv(lang);
+    appendEnv(cmStrCat(lang, "FLAGS"));
+
+    return hasher.FinalizeHex();
+  }
+
+  bool Load(std::string const& key, std::string const& compilerFile,
+            std::string& compiler) const
+  {
+    std::string data;
+    if (!cmSystemTools::ReadWholeFile(this->GetEntry(key), data)) {
+      return false;
+    }
+    std::istringstream in(data);
+    std::string magic;
+    std::string size;
+    std::string mtime;
+    if (!cmSystemTools::GetLineFromStream(in, magic) ||
+        magic != CompilerInformationCacheMagic ||
+        !cmSystemTools::GetLineFromStream(in, compiler) ||
+        !cmSystemTools::GetLineFromStream(in, size) ||
+        !cmSystemTools::GetLineFromStream(in, mtime)) {
+      return false;
+    }
+    if (!cmSystemTools::FileExists(compiler, true) ||
+        size != std::to_string(cmSystemTools::FileLength(compiler)) ||
+        mtime != std::to_string(cmSystemTools::ModifiedTime(compiler))) {
+      return false;
+    }
+    return cmSystemTools::WriteFileAtomically(
+      compilerFile,
+      data.substr(static_cast<std::size_t>(in.tellg()), std::string::npos));
+  }
+
+  void Store(std::string const& key, std::string const& compilerFile,
+             std::string const& compiler, std::string const& binaryDir) const
+  {
+    if (!cmSystemTools::FileIsFullPath(compiler) ||
+        !cmSystemTools::FileExists(compiler, true)) {
+      return;
+    }
+    std::string content;
+    if (!cmSystemTools::ReadWholeFile(compilerFile, content) ||
+        content.find(binaryDir) != std::string::npos) {
+      // Information that refers to the build tree cannot be shared.
+      return;
+    }
+    cmSystemTools::MakeDirectory(this->Directory);
+    cmSystemTools::WriteFileAtomically(
+      this->GetEntry(key),
+      cmStrCat(CompilerInformationCacheMagic, '\n', compiler, '\n',
+               cmSystemTools::FileLength(compiler), '\n',
+               cmSystemTools::ModifiedTime(compiler), '\n', content));
+  }
+
+private:
+  std::string GetEntry(std::string const& key) const
+  {
+    return cmStrCat(this->Directory, '/', key, ".cmake");
+  }
+
+  std::string Directory;
+};
+}
+
 bool cmTarget::StrictTargetComparison::operator()(cmTarget const* t1,
                                                   cmTarget const* t2) const
 {
@@ -750,9 +902,14 @@ void cmGlobalGenerator::EnableLanguage(
 
   std::map<std::string, bool> needTestLanguage;
   std::map<std::string, bool> needSetLanguageEnabledMaps;
+  CompilerInformationCache const compilerInfoCache;
+  std::map<std::string, std::string> compilerInfoKeys;
   // foreach language
   // load the CMakeDetermine(LANG)Compiler.cmake file to find
   // the compiler
+  // The languages are determined one after another, not concurrently:
+  // each step runs CMake code on this makefile, and the later steps read
+  // the variables and cache entries set by the earlier ones.
 
   for (std::string const& lang : languages) {
     needSetLanguageEnabledMaps[lang] = false;
@@ -764,6 +921,36 @@ void cmGlobalGenerator::EnableLanguage(
     if (!mf->GetDefinition(loadedLang)) {
       fpath = cmStrCat(rootBin, "/CMake", lang, "Compiler.cmake");
 
+      // A new build tree may reuse the information identified for the
+      // same compiler by another build tree.
+      if (compilerInfoCache.IsEnabled() &&
+          !this->CMakeInstance->GetIsInTryCompile() &&
+          !cmSystemTools::FileExists(fpath)) {
+        std::string key = compilerInfoCache.ComputeKey(mf, lang, rootBin);
+        std::string compiler;
+        bool const hit = compilerInfoCache.Load(key, fpath, compiler);
+#ifndef CMAKE_BOOTSTRAP
+        if (this->CMakeInstance->IsProfilingEnabled()) {
+          this->CMakeInstance->GetProfilingOutput().IncrementCounter(
+            "compiler_id_cache", hit ? "hits" : "misses");
+        }
+#endif
+        if (hit) {
+          std::string const compilerName =
+            cmStrCat("CMAKE_", lang, "_COMPILER");
+          if (!this->CMakeInstance->GetState()->GetCacheEntryValue(
+                compilerName)) {
+            mf->AddCacheDefinition(compilerName, compiler,
+                                   cmStrCat(lang, " compiler"),
+                                   cmStateEnums::FILEPATH);
+            this->CMakeInstance->GetState()->SetCacheEntryBoolProperty(
+              compilerName, "ADVANCED", true);
+          }
+        } else {
+          compilerInfoKeys[lang] = std::move(key);
+        }
+      }
+
       // If the existing build tree was already configured with this
       // version of CMake then try to load the configured file first
       // to avoid duplicate compiler tests.
@@ -945,6 +1132,14 @@ void cmGlobalGenerator::EnableLanguage(
           std::string compilerLangFile =
             cmStrCat(rootBin, "/CMake", lang, "Compiler.cmake");
           cmSystemTools::RemoveFile(compilerLangFile);
+        } else {
+          auto const key = compilerInfoKeys.find(lang);
+          if (key != compilerInfoKeys.end()) {
+            compilerInfoCache.Store(
+              key->second, cmStrCat(rootBin, "/CMake", lang, "Compiler.cmake"),
+              mf->GetSafeDefinition(compilerName),
+              this->CMakeInstance->GetHomeOutputDirectory());
+          }
         }
       } // end if in try compile
     }   // end need test language
@@ -1352,6 +1547,7 @@ void cmGlobalGenerator::Configure()
   this->FirstTimeProgress = 0.0f;
   this->ClearGeneratorMembers();
   this->NextDeferId = 0;
+  this->LoadDirectoryListings();
 
   cmStateSnapshot snapshot = this->CMakeInstance->GetCurrentSnapshot();
 
@@ -1403,6 +1599,8 @@ void cmGlobalGenerator::Configure()
   this->GetCMakeInstance()->AddCacheEntry(
     "CMAKE_NUMBER_OF_MAKEFILES", std::to_string(this->Makefiles.size()),
     "number of local generators", cmStateEnums::INTERNAL);
+
+  this->SaveDirectoryListings();
 }
 
 void cmGlobalGenerator::CreateGenerationObjects(TargetTypes targetTypes)
@@ -1717,6 +1915,9 @@ void cmGlobalGenerator::Generate()
   // Update rule hashes.
   this->CheckRuleHashes();
 
+  // Keep the directory listings read during generation.
+  this->SaveDirectoryListings();
+
   this->WriteSummary();
 
   if (this->ExtraGenerator) {
@@ -3287,6 +3488,9 @@ void cmGlobalGenerator::AddToManifest(std::string const& f)
   DirectoryContent& dc = this->DirectoryContentMap[dir];
   dc.Generated.insert(file);
   dc.All.insert(file);
+  if (dc.AllLowerCaseLoaded) {
+    dc.AllLowerCase.insert(cmSystemTools::LowerCase(file));
+  }
 }
 
 std::set<std::string> const& cmGlobalGenerator::GetDirectoryContent(
@@ -3294,28 +3498,185 @@ std::set<std::string> const& cmGlobalGenerator::GetDirectoryContent(
 {
   DirectoryContent& dc = this->DirectoryContentMap[dir];
   if (needDisk) {
-    long mt = cmSystemTools::ModifiedTime(dir);
-    if (mt != dc.LastDiskTime) {
+    cmFileTime ft;
+    long long const mt = ft.Load(dir) ? ft.GetTime() : 0;
+    // A directory modified in the last moments may be modified again
+    // without a visible change of its time stamp on file systems with a
+    // coarse resolution, so its content is re-loaded until it settles.
+    if (mt != dc.LastDiskTime || dc.RecentlyModified) {
       // Reset to non-loaded directory content.
       dc.All = dc.Generated;
+      dc.AllLowerCase.clear();
+      dc.AllLowerCaseLoaded = false;
 
       // Load the directory content from disk.
-      cmsys::Directory d;
-      if (d.Load(dir)) {
-        unsigned long n = d.GetNumberOfFiles();
-        for (unsigned long i = 0; i < n; ++i) {
-          const char* f = d.GetFile(i);
-          if (strcmp(f, ".") != 0 && strcmp(f, "..") != 0) {
-            dc.All.insert(f);
+      if (this->DirectoryListingsEnabled) {
+        DirectoryListing const& listing = this->ReadDirectoryListing(dir, mt);
+        dc.All.insert(listing.Files.begin(), listing.Files.end());
+      } else {
+        cmsys::Directory d;
+        if (d.Load(dir)) {
+          unsigned long n = d.GetNumberOfFiles();
+          for (unsigned long i = 0; i < n; ++i) {
+            const char* f = d.GetFile(i);
+            if (strcmp(f, ".") != 0 && strcmp(f, "..") != 0) {
+              dc.All.insert(f);
+            }
           }
         }
       }
       dc.LastDiskTime = mt;
+      cmFileTime now;
+      now.LoadCurrentTime();
+      dc.RecentlyModified =
+        mt != 0 && now.GetTime() - mt < 2 * cmFileTime::UtPerS;
     }
   }
   return dc.All;
 }
 
+std::set<std::string> const& cmGlobalGenerator::GetDirectoryContentLowerCase(
+  std::string const& dir)
+{
+  DirectoryContent& dc = this->DirectoryContentMap[dir];
+  if (!dc.AllLowerCaseLoaded) {
+    for (std::string const& f : dc.All) {
+      dc.AllLowerCase.insert(cmSystemTools::LowerCase(f));
+    }
+    dc.AllLowerCaseLoaded = true;
+  }
+  return dc.AllLowerCase;
+}
+
+namespace {
+char const DirectoryListingsMagic[] = "cmake-directory-listings-1";
+}
+
+std::string cmGlobalGenerator::GetDirectoryListingsFile() const
+{
+  return cmStrCat(this->CMakeInstance->GetHomeOutputDirectory(),
+                  "/CMakeFiles/DirectoryListings.cache");
+}
+
+void cmGlobalGenerator::LoadDirectoryListings()
+{
+  this->DirectoryListingsEnabled = false;
+  if (this->CMakeInstance->GetIsInTryCompile() ||
+      !this->CMakeInstance->GetState()->GetCacheEntryValue(
+         "CMAKE_FIND_DIRECTORY_LISTING_CACHE")
+         .IsOn()) {
+    this->DirectoryListings.clear();
+    return;
+  }
+  this->DirectoryListingsEnabled = true;
+  if (!this->DirectoryListings.empty()) {
+    // Listings of a previous configure step of this process are current.
+    return;
+  }
+
+  // Each entry is a directory, its modification time, the number of
+  // names in it and the names, one per line.
+  cmsys::ifstream fin(this->GetDirectoryListingsFile().c_str(),
+                      std::ios::in | std::ios::binary);
+  std::string line;
+  if (!fin || !cmSystemTools::GetLineFromStream(fin, line) ||
+      line != DirectoryListingsMagic) {
+    return;
+  }
+  std::string dir;
+  while (cmSystemTools::GetLineFromStream(fin, dir)) {
+    long long time;
+    unsigned long count;
+    if (!cmSystemTools::GetLineFromStream(fin, line) ||
+        !cmStrToLongLong(line, &time) ||
+        !cmSystemTools::GetLineFromStream(fin, line) ||
+        !cmStrToULong(line, &count)) {
+      this->DirectoryListings.clear();
+      return;
+    }
+    DirectoryListing& listing = this->DirectoryListings[dir];
+    listing.Time = time;
+    listing.Persistent = true;
+    listing.Files.clear();
+    listing.Files.reserve(count);
+    for (unsigned long i = 0; i < count; ++i) {
+      if (!cmSystemTools::GetLineFromStream(fin, line)) {
+        this->DirectoryListings.clear();
+        return;
+      }
+      listing.Files.emplace_back(std::move(line));
+    }
+  }
+}
+
+void cmGlobalGenerator::SaveDirectoryListings()
+{
+  if (!this->DirectoryListingsEnabled || !this->DirectoryListingsModified) {
+    return;
+  }
+  this->DirectoryListingsModified = false;
+
+  cmGeneratedFileStream fout(this->GetDirectoryListingsFile());
+  fout.SetCopyIfDifferent(true);
+  fout << DirectoryListingsMagic << '\n';
+  for (auto const& entry : this->DirectoryListings) {
+    DirectoryListing const& listing = entry.second;
+    if (!listing.Persistent) {
+      continue;
+    }
+    fout << entry.first << '\n'
+         << listing.Time << '\n'
+         << listing.Files.size() << '\n';
+    for (std::string const& f : listing.Files) {
+      fout << f << '\n';
+    }
+  }
+}
+
+cmGlobalGenerator::DirectoryListing const&
+cmGlobalGenerator::ReadDirectoryListing(std::string const& dir, long long time)
+{
+  DirectoryListing& listing = this->DirectoryListings[dir];
+  bool const hit = listing.Persistent && listing.Time == time;
+#ifndef CMAKE_BOOTSTRAP
+  if (this->CMakeInstance->IsProfilingEnabled()) {
+    this->CMakeInstance->GetProfilingOutput().IncrementCounter(
+      "directory_listing_cache", hit ? "hits" : "misses");
+  }
+#endif
+  if (hit) {
+    return listing;
+  }
+
+  listing.Time = time;
+  listing.Files.clear();
+  cmsys::Directory d;
+  if (d.Load(dir)) {
+    unsigned long n = d.GetNumberOfFiles();
+    listing.Files.reserve(n);
+    for (unsigned long i = 0; i < n; ++i) {
+      const char* f = d.GetFile(i);
+      if (strcmp(f, ".") != 0 && strcmp(f, "..") != 0) {
+        listing.Files.emplace_back(f);
+      }
+    }
+  }
+
+  // Listings of recently modified directories are not kept for later
+  // runs for the same reason they are re-loaded by GetDirectoryContent.
+  cmFileTime now;
+  now.LoadCurrentTime();
+  listing.Persistent = time != 0 &&
+    now.GetTime() - time >= 2 * cmFileTime::UtPerS &&
+    dir.find_first_of("\r\n") == std::string::npos &&
+    std::none_of(listing.Files.begin(), listing.Files.end(),
+                 [](std::string const& f) {
+                   return f.find_first_of("\r\n") != std::string::npos;
+                 });
+  this->DirectoryListingsModified = true;
+  return listing;
+}
+
 void cmGlobalGenerator::AddRuleHash(const std::vector<std::string>& outputs,
                                     std::string const& content)
 {
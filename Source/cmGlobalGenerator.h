@@ -475,10 +475,18 @@ public:
   /** Get the content of a directory.  Directory listings are cached
       and re-loaded from disk only when modified.  During the generation
       step the content will include the target files to be built even if
-      they do not yet exist.  */
+      they do not yet exist.  If CMAKE_FIND_DIRECTORY_LISTING_CACHE is
+      enabled the listings read from disk are also saved in the build
+      tree for later runs.  */
   std::set<std::string> const& GetDirectoryContent(std::string const& dir,
                                                    bool needDisk = true);
 
+  /** Get the names of the last content of a directory returned by
+      GetDirectoryContent converted to lower case.  The set is built on
+      first use for each content.  */
+  std::set<std::string> const& GetDirectoryContentLowerCase(
+    std::string const& dir);
+
   void IndexTarget(cmTarget* t);
   void IndexGeneratorTarget(cmGeneratorTarget* gt);
 
@@ -852,12 +860,32 @@ private:
   // Cache directory content and target files to be built.
   struct DirectoryContent
   {
-    long LastDiskTime = -1;
+    long long LastDiskTime = -1;
+    bool RecentlyModified = false;
     std::set<std::string> All;
     std::set<std::string> Generated;
+    std::set<std::string> AllLowerCase;
+    bool AllLowerCaseLoaded = false;
   };
   std::map<std::string, DirectoryContent> DirectoryContentMap;
 
+  // Directory listings read from disk, keyed by the modification time of
+  // the directory and kept for later runs in the same build tree.
+  struct DirectoryListing
+  {
+    long long Time = -1;
+    bool Persistent = false;
+    std::vector<std::string> Files;
+  };
+  std::map<std::string, DirectoryListing> DirectoryListings;
+  bool DirectoryListingsEnabled = false;
+  bool DirectoryListingsModified = false;
+  std::string GetDirectoryListingsFile() const;
+  void LoadDirectoryListings();
+  void SaveDirectoryListings();
+  DirectoryListing const& ReadDirectoryListing(std::string const& dir,
+                                               long long time);
+
   // Set of binary directories on disk.
   std::set<std::string> BinaryDirectories;
 
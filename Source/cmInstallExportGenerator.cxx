@@ -17,6 +17,7 @@
 #include "cmInstallType.h"
 #include "cmListFileCache.h"
 #include "cmLocalGenerator.h"
+#include "cmMakefile.h"
 #include "cmScriptGenerator.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
@@ -121,6 +122,9 @@ void cmInstallExportGenerator::GenerateScript(std::ostream& os)
     }
   }
   this->EFGen->SetExportPackageDependencies(this->ExportPackageDependencies);
+  this->EFGen->SetDeclarativeTargets(
+    this->LocalGenerator->GetMakefile()->IsOn(
+      "CMAKE_EXPORT_DECLARATIVE_TARGETS"));
   this->EFGen->GenerateImportFile();
 
   // Perform the main install script generation.
@@ -0,0 +1,44 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file Copyright.txt or https://cmake.org/licensing for details.  */
+#include "cmInternedString.h"
+
+#include <mutex>
+#include <ostream>
+#include <unordered_set>
+
+namespace {
+std::string const* Intern(std::string const& s)
+{
+  // Values may be interned by generators on worker threads.
+  static std::mutex poolMutex;
+  static std::unordered_set<std::string> pool;
+  std::lock_guard<std::mutex> lock(poolMutex);
+  return &*pool.insert(s).first;
+}
+
+std::string const* InternEmpty()
+{
+  static std::string const* const empty = Intern(std::string());
+  return empty;
+}
+}
+
+cmInternedString::cmInternedString()
+  : Value(InternEmpty())
+{
+}
+
+cmInternedString::cmInternedString(std::string const& s)
+  : Value(s.empty() ? InternEmpty() : Intern(s))
+{
+}
+
+cmInternedString::cmInternedString(const char* s)
+  : cmInternedString(std::string(s))
+{
+}
+
+std::ostream& operator<<(std::ostream& os, cmInternedString const& s)
+{
+  return os << s.str();
+}
@@ -0,0 +1,73 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file Copyright.txt or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <iosfwd>
+#include <string>
+
+/** \class cmInternedString
+ * \brief Handle to a string stored once per process.
+ *
+ * Constructing an instance looks the value up in a process-wide pool
+ * and refers to the pooled copy, so all instances with equal values
+ * share one buffer and compare equal by pointer.  The pool is never
+ * pruned, so use this only for values from a bounded vocabulary such
+ * as property names, list file paths and command names.
+ */
+class cmInternedString
+{
+public:
+  /** Refer to the empty string.  */
+  cmInternedString();
+
+  /** Refer to the pooled copy of the given value.  */
+  cmInternedString(std::string const& s);
+  cmInternedString(const char* s);
+
+  std::string const& str() const noexcept { return *this->Value; }
+  operator std::string const&() const noexcept { return *this->Value; }
+
+  const char* c_str() const noexcept { return this->Value->c_str(); }
+  bool empty() const noexcept { return this->Value->empty(); }
+  std::string::size_type size() const noexcept
+  {
+    return this->Value->size();
+  }
+
+  friend bool operator==(cmInternedString l, cmInternedString r) noexcept
+  {
+    return l.Value == r.Value;
+  }
+  friend bool operator!=(cmInternedString l, cmInternedString r) noexcept
+  {
+    return l.Value != r.Value;
+  }
+  friend bool operator<(cmInternedString l, cmInternedString r) noexcept
+  {
+    return l.Value != r.Value && *l.Value < *r.Value;
+  }
+
+private:
+  std::string const* Value;
+};
+
+inline bool operator==(cmInternedString l, std::string const& r) noexcept
+{
+  return l.str() == r;
+}
+inline bool operator==(std::string const& l, cmInternedString r) noexcept
+{
+  return l == r.str();
+}
+inline bool operator!=(cmInternedString l, std::string const& r) noexcept
+{
+  return l.str() != r;
+}
+inline bool operator!=(std::string const& l, cmInternedString r) noexcept
+{
+  return l != r.str();
+}
+
+std::ostream& operator<<(std::ostream& os, cmInternedString const& s);
@@ -952,53 +952,9 @@ cmList::container_type::iterator cmList::Insert(
       return container.insert(insertPos, std::move(value));
     }
 
-    std::string newValue;
-    // Break the string at non-escaped semicolons not nested in [].
-    int squareNesting = 0;
-    auto last = value.begin();
-    auto const cend = value.end();
-    for (auto c = last; c != cend; ++c) {
-      switch (*c) {
-        case '\\': {
-          // We only want to allow escaping of semicolons.  Other
-          // escapes should not be processed here.
-          auto cnext = c + 1;
-          if ((cnext != cend) && *cnext == ';') {
-            newValue.append(last, c);
-            // Skip over the escape character
-            last = cnext;
-            c = cnext;
-          }
-        } break;
-        case '[': {
-          ++squareNesting;
-        } break;
-        case ']': {
-          --squareNesting;
-        } break;
-        case ';': {
-          // brackets.
-          if (squareNesting == 0) {
-            newValue.append(last, c);
-            // Skip over the semicolon
-            last = c + 1;
-            if (!newValue.empty() || emptyElements == EmptyElements::Yes) {
-              // Add the last argument.
-              insertPos = container.insert(insertPos, newValue);
-              insertPos++;
-              newValue.clear();
-            }
-          }
-        } break;
-        default: {
-          // Just append this character.
-        } break;
-      }
-    }
-    newValue.append(last, cend);
-    if (!newValue.empty() || emptyElements == EmptyElements::Yes) {
-      // Add the last argument.
-      container.insert(insertPos, std::move(newValue));
+    for (cm::string_view element : cmListView(value, emptyElements)) {
+      insertPos = container.emplace(insertPos, element);
+      ++insertPos;
     }
   } else if (!value.empty() || emptyElements == EmptyElements::Yes) {
     return container.insert(insertPos, std::move(value));
@@ -1006,6 +962,57 @@ cmList::container_type::iterator cmList::Insert(
   return container.begin() + delta;
 }
 
+void cmListView::const_iterator::Advance()
+{
+  auto const size = this->List.size();
+  do {
+    if (this->Next == cmList::npos) {
+      this->Start = cmList::npos;
+      return;
+    }
+    this->Start = this->Next;
+    this->Escaped = false;
+    this->Unescaped.clear();
+
+    // Find the first semicolon that is neither escaped nor nested in [].
+    int squareNesting = 0;
+    auto last = this->Start;
+    auto pos = this->Start;
+    for (; pos < size; ++pos) {
+      char const c = this->List[pos];
+      if (c == '\\') {
+        // We only want to allow escaping of semicolons.  Other
+        // escapes should not be processed here.
+        if (pos + 1 < size && this->List[pos + 1] == ';') {
+          this->Unescaped.append(this->List.data() + last, pos - last);
+          this->Escaped = true;
+          // Skip over the escape character
+          last = ++pos;
+        }
+      } else if (c == '[') {
+        ++squareNesting;
+      } else if (c == ']') {
+        --squareNesting;
+      } else if (c == ';' && squareNesting == 0) {
+        break;
+      }
+    }
+
+    if (this->Escaped) {
+      this->Unescaped.append(this->List.data() + last, pos - last);
+    } else {
+      this->Element = this->List.substr(this->Start, pos - this->Start);
+    }
+    // Skip over the semicolon
+    this->Next = pos < size ? pos + 1 : cmList::npos;
+  } while (this->Empty == EmptyElements::No && (**this).empty());
+}
+
+cmListView::size_type cmListView::size() const
+{
+  return static_cast<size_type>(std::distance(this->begin(), this->end()));
+}
+
 std::string const& cmList::ToString(BT<std::string> const& s)
 {
   return s.Value;
@@ -1298,6 +1298,115 @@ cmList::TransformSelector::New<cmList::TransformSelector::REGEX>(
   return cmList::TransformSelector::NewREGEX(std::move(init));
 }
 
+/**
+ * Read-only view of the elements of a CMake list
+ *
+ * The elements are found while iterating over the list, following the
+ * expansion rules of cmList, and are referenced in place.  Only an element
+ * containing an escaped semicolon needs a buffer of its own.
+ *
+ * The viewed string must outlive the view and all of its iterators.
+ */
+class cmListView
+{
+public:
+  using value_type = cm::string_view;
+  using size_type = cmList::size_type;
+  using EmptyElements = cmList::EmptyElements;
+
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = cm::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = cm::string_view;
+
+    const_iterator() = default;
+
+    reference operator*() const
+    {
+      return this->Escaped ? cm::string_view(this->Unescaped) : this->Element;
+    }
+
+    const_iterator& operator++()
+    {
+      this->Advance();
+      return *this;
+    }
+    const_iterator operator++(int)
+    {
+      const_iterator i = *this;
+      this->Advance();
+      return i;
+    }
+
+    friend bool operator==(const_iterator const& lhs,
+                           const_iterator const& rhs)
+    {
+      return lhs.Start == rhs.Start;
+    }
+    friend bool operator!=(const_iterator const& lhs,
+                           const_iterator const& rhs)
+    {
+      return lhs.Start != rhs.Start;
+    }
+
+  private:
+    friend class cmListView;
+
+    const_iterator(cm::string_view list, EmptyElements emptyElements)
+      : List(list)
+      , Next(0)
+      , Empty(emptyElements)
+    {
+      this->Advance();
+    }
+
+    void Advance();
+
+    cm::string_view List;
+    // Offset of the current element, or npos at the end.
+    size_type Start = cmList::npos;
+    // Offset at which the next element starts, or npos after the last.
+    size_type Next = cmList::npos;
+    EmptyElements Empty = EmptyElements::No;
+    // The current element, unless it contained escaped semicolons.
+    cm::string_view Element;
+    bool Escaped = false;
+    std::string Unescaped;
+  };
+  using iterator = const_iterator;
+
+  cmListView(cm::string_view list,
+             EmptyElements emptyElements = EmptyElements::No)
+    : List(list)
+    , Empty(emptyElements)
+  {
+  }
+  cmListView(cmValue list, EmptyElements emptyElements = EmptyElements::No)
+    : cmListView(list ? cm::string_view(*list) : cm::string_view(),
+                 list ? emptyElements : EmptyElements::No)
+  {
+  }
+
+  const_iterator begin() const
+  {
+    return const_iterator(this->List, this->Empty);
+  }
+  const_iterator end() const { return const_iterator(); }
+
+  bool empty() const { return this->begin() == this->end(); }
+
+  // Count the elements.  This iterates over the whole list.
+  size_type size() const;
+
+private:
+  cm::string_view List;
+  EmptyElements Empty;
+};
+
 // Non-member functions
 // ====================
 inline std::vector<std::string>& operator+=(std::vector<std::string>& l,
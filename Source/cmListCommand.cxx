@@ -2,6 +2,7 @@
    file Copyright.txt or https://cmake.org/licensing for details.  */
 #include "cmListCommand.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
 #include <functional>
@@ -81,10 +82,12 @@ cm::optional<cmList> GetList(const std::string& var,
 {
   cm::optional<cmList> list;
 
-  std::string listString;
-  if (!GetListString(listString, var, makefile)) {
+  // Expand the value in place rather than copying it first.
+  cmValue listValue = makefile.GetDefinition(var);
+  if (!listValue) {
     return list;
   }
+  std::string const& listString = *listValue;
   // if the size of the list
   if (listString.empty()) {
     list.emplace();
@@ -128,6 +131,57 @@ cm::optional<cmList> GetList(const std::string& var,
   return list;
 }
 
+// Get a view of the elements of a list variable without copying them.
+// The view refers to the value of the variable, so it must not be used
+// after the variable changes.
+cm::optional<cmListView> GetListView(const std::string& var,
+                                     const cmMakefile& makefile)
+{
+  cm::optional<cmListView> view;
+
+  cmValue listValue = makefile.GetDefinition(var);
+  if (!listValue) {
+    return view;
+  }
+  // if the size of the list
+  if (listValue->empty()) {
+    view.emplace(cm::string_view());
+    return view;
+  }
+  // if no empty elements then just return
+  view.emplace(*listValue, cmList::EmptyElements::Yes);
+  if (std::find(view->begin(), view->end(), cm::string_view()) ==
+      view->end()) {
+    return view;
+  }
+  // if we have empty elements we need to check policy CMP0007
+  switch (makefile.GetPolicyStatus(cmPolicies::CMP0007)) {
+    case cmPolicies::WARN: {
+      // Default is to warn and use old behavior
+      // OLD behavior is to allow compatibility, so ignore empty values
+      view.emplace(*listValue);
+      std::string warn =
+        cmStrCat(cmPolicies::GetPolicyWarning(cmPolicies::CMP0007),
+                 " List has value = [", *listValue, "].");
+      makefile.IssueMessage(MessageType::AUTHOR_WARNING, warn);
+      return view;
+    }
+    case cmPolicies::OLD:
+      // OLD behavior is to allow compatibility, so ignore empty values
+      view.emplace(*listValue);
+      return view;
+    case cmPolicies::NEW:
+      return view;
+    case cmPolicies::REQUIRED_IF_USED:
+    case cmPolicies::REQUIRED_ALWAYS:
+      makefile.IssueMessage(
+        MessageType::FATAL_ERROR,
+        cmPolicies::GetRequiredPolicyError(cmPolicies::CMP0007));
+      return {};
+  }
+  return view;
+}
+
 bool HandleLengthCommand(std::vector<std::string> const& args,
                          cmExecutionStatus& status)
 {
@@ -139,7 +193,7 @@ bool HandleLengthCommand(std::vector<std::string> const& args,
   const std::string& listName = args[1];
   const std::string& variableName = args.back();
 
-  auto list = GetList(listName, status.GetMakefile());
+  auto list = GetListView(listName, status.GetMakefile());
   status.GetMakefile().AddDefinition(variableName,
                                      std::to_string(list ? list->size() : 0));
 
@@ -157,35 +211,50 @@ bool HandleGetCommand(std::vector<std::string> const& args,
   const std::string& listName = args[1];
   const std::string& variableName = args.back();
   // expand the variable
-  auto list = GetList(listName, status.GetMakefile());
+  auto list = GetListView(listName, status.GetMakefile());
   if (!list) {
     status.GetMakefile().AddDefinition(variableName, "NOTFOUND");
     return true;
   }
   // FIXME: Add policy to make non-existing lists an error like empty lists.
-  if (list->empty()) {
+  auto const length = static_cast<cmList::index_type>(list->size());
+  if (length == 0) {
     status.SetError("GET given empty list");
     return false;
   }
 
-  std::vector<int> indexes;
+  // Pair the position of each requested element with its result slot.
+  std::vector<std::pair<cmList::index_type, std::size_t>> positions;
   for (std::size_t cc = 2; cc < args.size() - 1; cc++) {
     int index;
     if (!GetIndexArg(args[cc], &index, status.GetMakefile())) {
       status.SetError(cmStrCat("index: ", args[cc], " is not a valid index"));
       return false;
     }
-    indexes.push_back(index);
+    cmList::index_type position = index < 0 ? length + index : index;
+    if (position < 0 || position >= length) {
+      status.SetError(cmStrCat("index: ", index, " out of range (-", length,
+                               ", ", length - 1, ")"));
+      return false;
+    }
+    positions.emplace_back(position, positions.size());
   }
 
-  try {
-    auto values = list->get_items(indexes.begin(), indexes.end());
-    status.GetMakefile().AddDefinition(variableName, values.to_string());
-    return true;
-  } catch (std::out_of_range& e) {
-    status.SetError(e.what());
-    return false;
+  // Find all requested elements in one pass over the list.
+  std::sort(positions.begin(), positions.end());
+  std::vector<std::string> values(positions.size());
+  auto next = positions.cbegin();
+  cmList::index_type position = 0;
+  for (auto element = list->begin();
+       element != list->end() && next != positions.cend();
+       ++element, ++position) {
+    for (; next != positions.cend() && next->first == position; ++next) {
+      values[next->second] = std::string(*element);
+    }
   }
+  status.GetMakefile().AddDefinition(variableName,
+                                     cmList::to_string(values));
+  return true;
 }
 
 bool HandleAppendCommand(std::vector<std::string> const& args,
@@ -200,12 +269,15 @@ bool HandleAppendCommand(std::vector<std::string> const& args,
 
   cmMakefile& makefile = status.GetMakefile();
   std::string const& listName = args[1];
-  // expand the variable
-  std::string listString;
-  GetListString(listString, listName, makefile);
+  std::string const items = cmList::to_string(cmMakeRange(args).advance(2));
 
-  makefile.AddDefinition(
-    listName, cmList::append(listString, args.begin() + 2, args.end()));
+  // Extend a non-empty list in place instead of copying it.
+  if (makefile.GetDefinition(listName).IsEmpty()) {
+    makefile.AddDefinition(listName, items);
+  } else {
+    makefile.AppendDefinition(listName,
+                              cmStrCat(cmList::element_separator, items));
+  }
   return true;
 }
 
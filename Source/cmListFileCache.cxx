@@ -3,6 +3,9 @@
 #define cmListFileCache_cxx
 #include "cmListFileCache.h"
 
+#include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -11,11 +14,14 @@
 #  include <cmsys/Encoding.hxx>
 #endif
 
+#include "cmCryptoHash.h"
 #include "cmList.h"
 #include "cmListFileLexer.h"
 #include "cmMessageType.h"
 #include "cmMessenger.h"
+#include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
+#include "cmVersion.h"
 
 struct cmListFileParser
 {
@@ -36,12 +42,13 @@ struct cmListFileParser
   cmListFile* ListFile;
   cmListFileBacktrace Backtrace;
   cmMessenger* Messenger;
-  const char* FileName = nullptr;
+  cmInternedString FileName;
   cmListFileLexer* Lexer;
   std::string FunctionName;
   long FunctionLine;
   long FunctionLineEnd;
   std::vector<cmListFileArgument> FunctionArguments;
+  bool IssuedWarning = false;
   enum
   {
     SeparationOkay,
@@ -181,6 +188,193 @@ bool cmListFileParser::Parse()
   return true;
 }
 
+namespace {
+/* The on-disk list file cache stores the functions parsed from a list
+   file under a name derived from a hash of the file content.  Entries
+   are only written for files that parsed without any diagnostics, so
+   loading an entry is indistinguishable from parsing the file.  */
+char const ListFileCacheMagic[] = "cmake-list-file-cache-1";
+std::uint32_t const ListFileCacheByteOrder = 0x01020304;
+
+class ListFileCacheReader
+{
+public:
+  ListFileCacheReader(std::string data)
+    : Data(std::move(data))
+  {
+  }
+
+  bool ReadInteger(std::int64_t& value)
+  {
+    return this->ReadRaw(&value, sizeof(value));
+  }
+
+  bool ReadString(std::string& value)
+  {
+    std::int64_t size;
+    if (!this->ReadInteger(size) || size < 0 ||
+        static_cast<std::uint64_t>(size) > this->Data.size() - this->Pos) {
+      return false;
+    }
+    value.assign(this->Data, this->Pos, static_cast<std::size_t>(size));
+    this->Pos += static_cast<std::size_t>(size);
+    return true;
+  }
+
+  bool ReadRaw(void* value, std::size_t size)
+  {
+    if (size > this->Data.size() - this->Pos) {
+      return false;
+    }
+    memcpy(value, this->Data.data() + this->Pos, size);
+    this->Pos += size;
+    return true;
+  }
+
+  bool AtEnd() const { return this->Pos == this->Data.size(); }
+
+private:
+  std::string Data;
+  std::size_t Pos = 0;
+};
+
+class ListFileCacheWriter
+{
+public:
+  void WriteInteger(std::int64_t value)
+  {
+    this->WriteRaw(&value, sizeof(value));
+  }
+
+  void WriteString(std::string const& value)
+  {
+    this->WriteInteger(static_cast<std::int64_t>(value.size()));
+    this->Data.append(value);
+  }
+
+  void WriteRaw(void const* value, std::size_t size)
+  {
+    this->Data.append(static_cast<char const*>(value), size);
+  }
+
+  std::string const& GetData() const { return this->Data; }
+
+private:
+  std::string Data;
+};
+
+std::string ListFileCacheHeader()
+{
+  ListFileCacheWriter writer;
+  writer.WriteString(ListFileCacheMagic);
+  writer.WriteRaw(&ListFileCacheByteOrder, sizeof(ListFileCacheByteOrder));
+  writer.WriteString(cmVersion::GetCMakeVersion());
+  return writer.GetData();
+}
+
+/* Return the path of the cache entry for the given list file, or an
+   empty string if the cache is disabled or the file cannot be read.
+   The entry is named after a hash of the file content and of the
+   header, which holds the version of CMake.  */
+std::string ListFileCacheEntry(const char* filename)
+{
+  std::string dir;
+  if (!cmSystemTools::GetEnv("CMAKE_LIST_FILE_CACHE_DIR", dir) ||
+      dir.empty()) {
+    return std::string();
+  }
+  std::string content;
+  if (!cmSystemTools::ReadWholeFile(filename, content)) {
+    return std::string();
+  }
+  // Each version of CMake uses its own entries, so that build trees
+  // configured by different versions do not replace each other's.
+  cmCryptoHash hasher(cmCryptoHash::AlgoSHA256);
+  hasher.Initialize();
+  hasher.Append(ListFileCacheHeader());
+  hasher.Append(content);
+  return cmStrCat(cmSystemTools::CollapseFullPath(dir), '/',
+                  hasher.FinalizeHex(), ".lfc");
+}
+
+bool LoadListFileCacheEntry(std::string const& entry,
+                            std::vector<cmListFileFunction>& functions)
+{
+  std::string data;
+  if (!cmSystemTools::ReadWholeFile(entry, data)) {
+    return false;
+  }
+  std::string const header = ListFileCacheHeader();
+  if (data.compare(0, header.size(), header) != 0) {
+    return false;
+  }
+  ListFileCacheReader reader(data.substr(header.size()));
+
+  std::int64_t count;
+  if (!reader.ReadInteger(count) || count < 0) {
+    return false;
+  }
+  std::vector<cmListFileFunction> loaded;
+  for (std::int64_t i = 0; i < count; ++i) {
+    std::string name;
+    std::int64_t line;
+    std::int64_t lineEnd;
+    std::int64_t argCount;
+    if (!reader.ReadString(name) || !reader.ReadInteger(line) ||
+        !reader.ReadInteger(lineEnd) || !reader.ReadInteger(argCount) ||
+        argCount < 0) {
+      return false;
+    }
+    std::vector<cmListFileArgument> args;
+    for (std::int64_t j = 0; j < argCount; ++j) {
+      std::string value;
+      std::int64_t delim;
+      std::int64_t argLine;
+      if (!reader.ReadString(value) || !reader.ReadInteger(delim) ||
+          !reader.ReadInteger(argLine) ||
+          delim < cmListFileArgument::Unquoted ||
+          delim > cmListFileArgument::Bracket) {
+        return false;
+      }
+      args.emplace_back(std::move(value),
+                        static_cast<cmListFileArgument::Delimiter>(delim),
+                        static_cast<long>(argLine));
+    }
+    loaded.emplace_back(std::move(name), static_cast<long>(line),
+                        static_cast<long>(lineEnd), std::move(args));
+  }
+  if (!reader.AtEnd()) {
+    return false;
+  }
+
+  std::move(loaded.begin(), loaded.end(), std::back_inserter(functions));
+  return true;
+}
+
+void StoreListFileCacheEntry(std::string const& entry,
+                             std::vector<cmListFileFunction> const& functions)
+{
+  ListFileCacheWriter writer;
+  writer.WriteInteger(static_cast<std::int64_t>(functions.size()));
+  for (cmListFileFunction const& func : functions) {
+    writer.WriteString(func.OriginalName());
+    writer.WriteInteger(func.Line());
+    writer.WriteInteger(func.LineEnd());
+    writer.WriteInteger(static_cast<std::int64_t>(func.Arguments().size()));
+    for (cmListFileArgument const& arg : func.Arguments()) {
+      writer.WriteString(arg.Value);
+      writer.WriteInteger(arg.Delim);
+      writer.WriteInteger(arg.Line);
+    }
+  }
+
+  // Concurrent configure processes must never observe a partial entry.
+  cmSystemTools::MakeDirectory(cmSystemTools::GetFilenamePath(entry));
+  cmSystemTools::WriteFileAtomically(
+    entry, cmStrCat(ListFileCacheHeader(), writer.GetData()));
+}
+}
+
 bool cmListFile::ParseFile(const char* filename, cmMessenger* messenger,
                            cmListFileBacktrace const& lfbt)
 {
@@ -189,11 +383,22 @@ bool cmListFile::ParseFile(const char* filename, cmMessenger* messenger,
     return false;
   }
 
+  std::string const cacheEntry = ListFileCacheEntry(filename);
+  if (!cacheEntry.empty() &&
+      LoadListFileCacheEntry(cacheEntry, this->Functions)) {
+    return true;
+  }
+
   bool parseError = false;
 
   {
     cmListFileParser parser(this, lfbt, messenger);
     parseError = !parser.ParseFile(filename);
+    this->Reusable = !parser.IssuedWarning;
+  }
+
+  if (!parseError && this->Reusable && !cacheEntry.empty()) {
+    StoreListFileCacheEntry(cacheEntry, this->Functions);
   }
 
   return !parseError;
@@ -208,6 +413,7 @@ bool cmListFile::ParseString(const char* str, const char* virtual_filename,
   {
     cmListFileParser parser(this, lfbt, messenger);
     parseError = !parser.ParseString(str, virtual_filename);
+    this->Reusable = !parser.IssuedWarning;
   }
 
   return !parseError;
@@ -335,6 +541,7 @@ bool cmListFileParser::AddArgument(cmListFileLexer_Token* token,
     return false;
   }
   this->Messenger->IssueMessage(MessageType::AUTHOR_WARNING, m.str(), lfbt);
+  this->IssuedWarning = true;
   return true;
 }
 
@@ -4,6 +4,8 @@
 
 #include "cmConfigure.h" // IWYU pragma: keep
 
+#include <cstddef>
+#include <functional>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -13,6 +15,7 @@
 #include <cm/optional>
 
 #include "cmConstStack.h"
+#include "cmInternedString.h"
 #include "cmList.h"
 #include "cmSystemTools.h"
 
@@ -23,6 +26,7 @@
  * cmake list files.
  */
 
+class cmExecutionStatus;
 class cmMessenger;
 
 struct cmListFileArgument
@@ -62,7 +66,7 @@ public:
 
   std::string const& OriginalName() const noexcept
   {
-    return this->Impl->OriginalName;
+    return this->Impl->OriginalName.str();
   }
 
   std::string const& LowerCaseName() const noexcept
@@ -78,24 +82,58 @@ public:
     return this->Impl->Arguments;
   }
 
+  using Command = std::function<bool(std::vector<cmListFileArgument> const&,
+                                     cmExecutionStatus&)>;
+
+  // Get the command this function was last resolved to, which is nullptr
+  // if no command had its name.  Returns false if the function was not
+  // resolved against the given generation of defined commands.
+  bool GetResolvedCommand(std::size_t generation,
+                          Command const*& command) const noexcept
+  {
+    if (this->Impl->ResolvedGeneration != generation) {
+      return false;
+    }
+    command = this->Impl->ResolvedCommand;
+    return true;
+  }
+
+  // The command is not owned: it must stay valid as long as the
+  // generation of defined commands does not change.
+  void SetResolvedCommand(std::size_t generation,
+                          Command const* command) const noexcept
+  {
+    this->Impl->ResolvedCommand = command;
+    this->Impl->ResolvedGeneration = generation;
+  }
+
 private:
+  friend class cmListFileContext;
+
   struct Implementation
   {
     Implementation(std::string name, long line, long lineEnd,
                    std::vector<cmListFileArgument> args)
       : OriginalName{ std::move(name) }
-      , LowerCaseName{ cmSystemTools::LowerCase(this->OriginalName) }
+      , LowerCaseName{ cmSystemTools::LowerCase(this->OriginalName.str()) }
       , Line{ line }
       , LineEnd{ lineEnd }
       , Arguments{ std::move(args) }
     {
     }
 
-    std::string OriginalName;
+    // Interned once here for the contexts of all executions.
+    cmInternedString OriginalName;
     std::string LowerCaseName;
     long Line = 0;
     long LineEnd = 0;
     std::vector<cmListFileArgument> Arguments;
+
+    // Cache of the command lookup, shared by all copies of the function.
+    // A function defined by the user holds its body, so owning the
+    // command here would keep recursive functions alive forever.
+    mutable Command const* ResolvedCommand = nullptr;
+    mutable std::size_t ResolvedGeneration = 0;
   };
 
   std::shared_ptr<Implementation const> Impl;
@@ -104,8 +142,10 @@ private:
 class cmListFileContext
 {
 public:
-  std::string Name;
-  std::string FilePath;
+  // Every command invocation pushes a context and backtraces recorded
+  // on targets keep them alive, so share the file path and name strings.
+  cmInternedString Name;
+  cmInternedString FilePath;
   long Line = 0;
   static long const DeferPlaceholderLine = -1;
   cm::optional<std::string> DeferId;
@@ -129,14 +169,15 @@ public:
     delete;
 #endif
 
-  cmListFileContext(std::string name, std::string filePath, long line)
-    : Name(std::move(name))
-    , FilePath(std::move(filePath))
+  cmListFileContext(cmInternedString name, cmInternedString filePath,
+                    long line)
+    : Name(name)
+    , FilePath(filePath)
     , Line(line)
   {
   }
 
-  static cmListFileContext FromListFilePath(std::string const& filePath)
+  static cmListFileContext FromListFilePath(cmInternedString filePath)
   {
     // We are entering a file-level scope but have not yet reached
     // any specific line or command invocation within it.  This context
@@ -148,13 +189,13 @@ public:
   }
 
   static cmListFileContext FromListFileFunction(
-    cmListFileFunction const& lff, std::string const& fileName,
+    cmListFileFunction const& lff, cmInternedString fileName,
     cm::optional<std::string> deferId = {})
   {
     cmListFileContext lfc;
     lfc.FilePath = fileName;
     lfc.Line = lff.Line();
-    lfc.Name = lff.OriginalName();
+    lfc.Name = lff.Impl->OriginalName;
     lfc.DeferId = std::move(deferId);
     return lfc;
   }
@@ -244,4 +285,8 @@ struct cmListFile
                    cmMessenger* messenger, cmListFileBacktrace const& lfbt);
 
   std::vector<cmListFileFunction> Functions;
+
+  // Whether the parse issued no diagnostics, so that its result may be
+  // reused in place of parsing the same content again.
+  bool Reusable = true;
 };
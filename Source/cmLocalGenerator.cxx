@@ -995,7 +995,7 @@ void cmLocalGenerator::AddCompileOptions(std::vector<BT<std::string>>& flags,
         flags.emplace_back(std::move(compileOpts));
       }
     }
-    std::vector<BT<std::string>> targetCompileOpts =
+    std::vector<BT<std::string>> const& targetCompileOpts =
       target->GetCompileOptions(config, lang);
     // COMPILE_OPTIONS are escaped.
     this->AppendCompileOptions(flags, targetCompileOpts,
@@ -1010,7 +1010,7 @@ void cmLocalGenerator::AddCompileOptions(std::vector<BT<std::string>>& flags,
         flags.emplace_back(std::move(compileFlags));
       }
     }
-    std::vector<BT<std::string>> targetCompileOpts =
+    std::vector<BT<std::string>> const& targetCompileOpts =
       target->GetCompileOptions(config, lang);
     // COMPILE_OPTIONS are escaped.
     this->AppendCompileOptions(flags, targetCompileOpts);
@@ -1516,7 +1516,7 @@ void cmLocalGenerator::GetTargetFlags(
         linkFlags.emplace_back(std::move(sharedLibFlags));
       }
 
-      std::vector<BT<std::string>> linkOpts =
+      std::vector<BT<std::string>> const& linkOpts =
         target->GetLinkOptions(config, linkLanguage);
       this->SetLinkScriptShell(this->GetGlobalGenerator()->GetUseLinkScript());
       // LINK_OPTIONS are escaped.
@@ -1601,7 +1601,7 @@ void cmLocalGenerator::GetTargetFlags(
         linkFlags.emplace_back(std::move(exeFlags));
       }
 
-      std::vector<BT<std::string>> linkOpts =
+      std::vector<BT<std::string>> const& linkOpts =
         target->GetLinkOptions(config, linkLanguage);
       this->SetLinkScriptShell(this->GetGlobalGenerator()->GetUseLinkScript());
       // LINK_OPTIONS are escaped.
@@ -1829,7 +1829,7 @@ std::set<BT<std::string>> cmLocalGenerator::GetTargetDefines(
   }
 
   // Add preprocessor definitions for this target and configuration.
-  std::vector<BT<std::string>> targetDefines =
+  std::vector<BT<std::string>> const& targetDefines =
     target->GetCompileDefinitions(config, lang);
   this->AppendDefines(defines, targetDefines);
 
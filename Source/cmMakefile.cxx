@@ -430,7 +430,7 @@ public:
             argsValue["functionArgs"] = args;
           }
           argsValue["location"] =
-            cmStrCat(lfc.FilePath, ':', std::to_string(lfc.Line));
+            cmStrCat(lfc.FilePath.str(), ':', std::to_string(lfc.Line));
           return argsValue;
         });
 #endif
@@ -506,8 +506,7 @@ bool cmMakefile::ExecuteCommand(const cmListFileFunction& lff,
   }
 
   // Lookup the command prototype.
-  if (cmState::Command command =
-        this->GetState()->GetCommandByExactName(lff.LowerCaseName())) {
+  if (cmState::Command command = this->GetState()->ResolveCommand(lff)) {
     // Decide whether to invoke the command.
     if (!cmSystemTools::GetFatalErrorOccurred()) {
       // if trace is enabled, print out invoke information
@@ -701,8 +700,9 @@ bool cmMakefile::ReadDependentFile(const std::string& filename,
 #endif
 
   cmListFile listFile;
-  if (!listFile.ParseFile(filenametoread.c_str(), this->GetMessenger(),
-                          this->Backtrace)) {
+  if (!this->GetState()->ParseListFile(filenametoread, listFile,
+                                       this->GetMessenger(),
+                                       this->Backtrace)) {
 #ifdef CMake_ENABLE_DEBUGGER
     if (this->GetCMakeInstance()->GetDebugAdapter() != nullptr) {
       this->GetCMakeInstance()->GetDebugAdapter()->OnEndFileParse();
@@ -823,8 +823,9 @@ bool cmMakefile::ReadListFile(const std::string& filename)
 #endif
 
   cmListFile listFile;
-  if (!listFile.ParseFile(filenametoread.c_str(), this->GetMessenger(),
-                          this->Backtrace)) {
+  if (!this->GetState()->ParseListFile(filenametoread, listFile,
+                                       this->GetMessenger(),
+                                       this->Backtrace)) {
 #ifdef CMake_ENABLE_DEBUGGER
     if (this->GetCMakeInstance()->GetDebugAdapter() != nullptr) {
       this->GetCMakeInstance()->GetDebugAdapter()->OnEndFileParse();
@@ -1622,7 +1623,7 @@ void cmMakefile::AddTestGenerator(std::unique_ptr<cmTestGenerator> g)
   }
 }
 
-void cmMakefile::PushFunctionScope(std::string const& fileName,
+void cmMakefile::PushFunctionScope(cmInternedString fileName,
                                    const cmPolicies::PolicyMap& pm)
 {
   this->StateSnapshot = this->GetState()->CreateFunctionCallSnapshot(
@@ -1655,7 +1656,7 @@ void cmMakefile::PopFunctionScope(bool reportError)
   this->PopLoopBlockBarrier();
 }
 
-void cmMakefile::PushMacroScope(std::string const& fileName,
+void cmMakefile::PushMacroScope(cmInternedString fileName,
                                 const cmPolicies::PolicyMap& pm)
 {
   this->StateSnapshot =
@@ -1758,8 +1759,9 @@ void cmMakefile::Configure()
 #endif
 
   cmListFile listFile;
-  if (!listFile.ParseFile(currentStart.c_str(), this->GetMessenger(),
-                          this->Backtrace)) {
+  if (!this->GetState()->ParseListFile(currentStart, listFile,
+                                       this->GetMessenger(),
+                                       this->Backtrace)) {
 #ifdef CMake_ENABLE_DEBUGGER
     if (this->GetCMakeInstance()->GetDebugAdapter() != nullptr) {
       this->GetCMakeInstance()->GetDebugAdapter()->OnEndFileParse();
@@ -2049,6 +2051,28 @@ void cmMakefile::AddDefinition(const std::string& name, cm::string_view value)
 #endif
 }
 
+void cmMakefile::AppendDefinition(const std::string& name,
+                                  cm::string_view value)
+{
+  if (!this->StateSnapshot.AppendDefinition(name, value)) {
+    cmValue oldValue = this->StateSnapshot.GetDefinition(name);
+    if (!oldValue) {
+      oldValue = this->GetState()->GetInitializedCacheValue(name);
+    }
+    this->AddDefinition(name, cmStrCat(*oldValue, value));
+    return;
+  }
+
+#ifndef CMAKE_BOOTSTRAP
+  cmVariableWatch* vv = this->GetVariableWatch();
+  if (vv) {
+    vv->VariableAccessed(name, cmVariableWatch::VARIABLE_MODIFIED_ACCESS,
+                         this->StateSnapshot.GetDefinition(name).GetCStr(),
+                         this);
+  }
+#endif
+}
+
 void cmMakefile::AddDefinitionBool(const std::string& name, bool value)
 {
   this->AddDefinition(name, value ? "ON" : "OFF");
@@ -4589,10 +4613,15 @@ void cmMakefile::ClearMatches()
 }
 
 void cmMakefile::StoreMatches(cmsys::RegularExpression& re)
+{
+  this->StoreMatches(re.regMatch());
+}
+
+void cmMakefile::StoreMatches(cmsys::RegularExpressionMatch const& match)
 {
   char highest = 0;
   for (int i = 0; i < 10; i++) {
-    std::string const& m = re.match(i);
+    std::string const& m = match.match(i);
     if (!m.empty()) {
       std::string const& var = matchVariables[i];
       this->AddDefinition(var, m);
@@ -4772,7 +4801,7 @@ bool cmMakefile::IgnoreErrorsCMP0061() const
 }
 
 cmMakefile::FunctionPushPop::FunctionPushPop(cmMakefile* mf,
-                                             const std::string& fileName,
+                                             cmInternedString fileName,
                                              cmPolicies::PolicyMap const& pm)
   : Makefile(mf)
 {
@@ -4785,7 +4814,7 @@ cmMakefile::FunctionPushPop::~FunctionPushPop()
 }
 
 cmMakefile::MacroPushPop::MacroPushPop(cmMakefile* mf,
-                                       const std::string& fileName,
+                                       cmInternedString fileName,
                                        const cmPolicies::PolicyMap& pm)
   : Makefile(mf)
 {
@@ -27,6 +27,7 @@
 #include "cmCustomCommand.h"
 #include "cmFindPackageStack.h"
 #include "cmFunctionBlocker.h"
+#include "cmInternedString.h"
 #include "cmListFileCache.h"
 #include "cmMessageType.h" // IWYU pragma: keep
 #include "cmNewLineStyle.h"
@@ -300,6 +301,11 @@ public:
   {
     this->AddDefinition(name, *value);
   }
+  /**
+   * Append to the value of a variable definition.  Repeated appends to
+   * a variable of the current scope extend its value in place.
+   */
+  void AppendDefinition(const std::string& name, cm::string_view value);
   /**
    * Add bool variable definition to the build.
    */
@@ -865,7 +871,7 @@ public:
   class FunctionPushPop
   {
   public:
-    FunctionPushPop(cmMakefile* mf, std::string const& fileName,
+    FunctionPushPop(cmMakefile* mf, cmInternedString fileName,
                     cmPolicies::PolicyMap const& pm);
     ~FunctionPushPop();
 
@@ -882,7 +888,7 @@ public:
   class MacroPushPop
   {
   public:
-    MacroPushPop(cmMakefile* mf, std::string const& fileName,
+    MacroPushPop(cmMakefile* mf, cmInternedString fileName,
                  cmPolicies::PolicyMap const& pm);
     ~MacroPushPop();
 
@@ -896,10 +902,10 @@ public:
     bool ReportError = true;
   };
 
-  void PushFunctionScope(std::string const& fileName,
+  void PushFunctionScope(cmInternedString fileName,
                          cmPolicies::PolicyMap const& pm);
   void PopFunctionScope(bool reportError);
-  void PushMacroScope(std::string const& fileName,
+  void PushMacroScope(cmInternedString fileName,
                       cmPolicies::PolicyMap const& pm);
   void PopMacroScope(bool reportError);
   void PushScope();
@@ -1000,6 +1006,7 @@ public:
 
   void ClearMatches();
   void StoreMatches(cmsys::RegularExpression& re);
+  void StoreMatches(cmsys::RegularExpressionMatch const& match);
 
   cmStateSnapshot GetStateSnapshot() const;
 
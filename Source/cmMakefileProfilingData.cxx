@@ -34,6 +34,7 @@ cmMakefileProfilingData::~cmMakefileProfilingData() noexcept
 {
   if (this->ProfileStream.good()) {
     try {
+      this->WriteCounters();
       this->ProfileStream << "]";
       this->ProfileStream.close();
     } catch (...) {
@@ -106,6 +107,36 @@ void cmMakefileProfilingData::StopEntry()
   }
 }
 
+void cmMakefileProfilingData::IncrementCounter(const std::string& name,
+                                               const std::string& series)
+{
+  ++this->Counters[name][series];
+}
+
+void cmMakefileProfilingData::WriteCounters()
+{
+  cmsys::SystemInformation info;
+  for (auto const& counter : this->Counters) {
+    if (this->ProfileStream.tellp() > 1) {
+      this->ProfileStream << ",";
+    }
+    Json::Value v;
+    v["ph"] = "C";
+    v["name"] = counter.first;
+    v["ts"] = static_cast<Json::Value::UInt64>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count());
+    v["pid"] = static_cast<int>(info.GetProcessId());
+    v["tid"] = 0;
+    Json::Value& args = v["args"] = Json::objectValue;
+    for (auto const& series : counter.second) {
+      args[series.first] = static_cast<Json::Value::UInt64>(series.second);
+    }
+    this->JsonWriter->write(v, &this->ProfileStream);
+  }
+}
+
 cmMakefileProfilingData::RAII::RAII(cmMakefileProfilingData& data,
                                     const std::string& category,
                                     const std::string& name,
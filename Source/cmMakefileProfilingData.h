@@ -1,6 +1,8 @@
 /* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
    file Copyright.txt or https://cmake.org/licensing for details.  */
 #pragma once
+#include <cstddef>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -23,6 +25,10 @@ public:
                   cm::optional<Json::Value> args = cm::nullopt);
   void StopEntry();
 
+  /** Count an event.  The totals are written as counter entries when
+      the profile is finished.  */
+  void IncrementCounter(const std::string& name, const std::string& series);
+
   class RAII
   {
   public:
@@ -44,6 +50,9 @@ public:
   };
 
 private:
+  void WriteCounters();
+
   cmsys::ofstream ProfileStream;
+  std::map<std::string, std::map<std::string, std::size_t>> Counters;
   std::unique_ptr<Json::StreamWriter> JsonWriter;
 };
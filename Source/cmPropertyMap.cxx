@@ -3,21 +3,97 @@
 #include "cmPropertyMap.h"
 
 #include <algorithm>
+#include <unordered_map>
 #include <utility>
 
+namespace {
+// Values such as "ON" or "CXX" are repeated on many targets and source
+// files.  Share one buffer for each of these well-known values.  The set
+// is fixed, so it needs no lock and does not grow with the project.
+std::unordered_map<std::string, cm::String> const& SharedValues()
+{
+  static std::unordered_map<std::string, cm::String> const values = [] {
+    std::unordered_map<std::string, cm::String> m;
+    for (char const* v :
+         { "0", "1", "ON", "OFF", "TRUE", "FALSE", "YES", "NO", "Y", "N",
+           "C", "CXX", "CUDA", "HIP", "Fortran", "ASM", "OBJC", "OBJCXX",
+           "ISPC", "Swift", "EXECUTABLE", "STATIC_LIBRARY",
+           "SHARED_LIBRARY", "MODULE_LIBRARY", "OBJECT_LIBRARY",
+           "INTERFACE_LIBRARY" }) {
+      m.emplace(v, cm::String(std::string(v)));
+    }
+    return m;
+  }();
+  return values;
+}
+
+void AssignValue(cm::String& pVal, std::string const& value)
+{
+  auto const& shared = SharedValues();
+  auto it = shared.find(value);
+  if (it != shared.end()) {
+    pVal = it->second;
+  } else {
+    pVal = value;
+  }
+}
+
+struct EntryLess
+{
+  template <typename E>
+  bool operator()(E const& entry, std::string const& name) const
+  {
+    return entry.Key.str() < name;
+  }
+};
+}
+
+cmPropertyMap::EntryVector::iterator cmPropertyMap::Find(
+  const std::string& name)
+{
+  auto it = std::lower_bound(this->Entries_.begin(), this->Entries_.end(),
+                             name, EntryLess());
+  if (it != this->Entries_.end() && it->Key == name) {
+    return it;
+  }
+  return this->Entries_.end();
+}
+
+cmPropertyMap::EntryVector::const_iterator cmPropertyMap::Find(
+  const std::string& name) const
+{
+  auto it = std::lower_bound(this->Entries_.begin(), this->Entries_.end(),
+                             name, EntryLess());
+  if (it != this->Entries_.end() && it->Key == name) {
+    return it;
+  }
+  return this->Entries_.end();
+}
+
+cm::String& cmPropertyMap::Emplace(const std::string& name)
+{
+  auto it = std::lower_bound(this->Entries_.begin(), this->Entries_.end(),
+                             name, EntryLess());
+  if (it == this->Entries_.end() || it->Key != name) {
+    it = this->Entries_.insert(
+      it, Entry{ cmInternedString(name), cm::String() });
+  }
+  return it->Value;
+}
+
 void cmPropertyMap::Clear()
 {
-  this->Map_.clear();
+  this->Entries_.clear();
 }
 
 void cmPropertyMap::SetProperty(const std::string& name, cmValue value)
 {
   if (!value) {
-    this->Map_.erase(name);
+    this->RemoveProperty(name);
     return;
   }
 
-  this->Map_[name] = *value;
+  AssignValue(this->Emplace(name), *value);
 }
 
 void cmPropertyMap::AppendProperty(const std::string& name,
@@ -29,8 +105,12 @@ void cmPropertyMap::AppendProperty(const std::string& name,
   }
 
   {
-    std::string& pVal = this->Map_[name];
-    if (!pVal.empty() && !asString) {
+    cm::String& pVal = this->Emplace(name);
+    if (pVal.empty()) {
+      AssignValue(pVal, value);
+      return;
+    }
+    if (!asString) {
       pVal += ';';
     }
     pVal += value;
@@ -39,14 +119,17 @@ void cmPropertyMap::AppendProperty(const std::string& name,
 
 void cmPropertyMap::RemoveProperty(const std::string& name)
 {
-  this->Map_.erase(name);
+  auto it = this->Find(name);
+  if (it != this->Entries_.end()) {
+    this->Entries_.erase(it);
+  }
 }
 
 cmValue cmPropertyMap::GetPropertyValue(const std::string& name) const
 {
-  auto it = this->Map_.find(name);
-  if (it != this->Map_.end()) {
-    return cmValue(it->second);
+  auto it = this->Find(name);
+  if (it != this->Entries_.end()) {
+    return cmValue(it->Value.str_if_stable());
   }
   return nullptr;
 }
@@ -54,11 +137,10 @@ cmValue cmPropertyMap::GetPropertyValue(const std::string& name) const
 std::vector<std::string> cmPropertyMap::GetKeys() const
 {
   std::vector<std::string> keyList;
-  keyList.reserve(this->Map_.size());
-  for (auto const& item : this->Map_) {
-    keyList.push_back(item.first);
+  keyList.reserve(this->Entries_.size());
+  for (auto const& item : this->Entries_) {
+    keyList.push_back(item.Key);
   }
-  std::sort(keyList.begin(), keyList.end());
   return keyList;
 }
 
@@ -66,13 +148,9 @@ std::vector<std::pair<std::string, std::string>> cmPropertyMap::GetList() const
 {
   using StringPair = std::pair<std::string, std::string>;
   std::vector<StringPair> kvList;
-  kvList.reserve(this->Map_.size());
-  for (auto const& item : this->Map_) {
-    kvList.emplace_back(item.first, item.second);
+  kvList.reserve(this->Entries_.size());
+  for (auto const& item : this->Entries_) {
+    kvList.emplace_back(item.Key.str(), *item.Value.str_if_stable());
   }
-  std::sort(kvList.begin(), kvList.end(),
-            [](StringPair const& a, StringPair const& b) {
-              return a.first < b.first;
-            });
   return kvList;
 }
@@ -5,14 +5,21 @@
 #include "cmConfigure.h" // IWYU pragma: keep
 
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "cmInternedString.h"
+#include "cmString.hxx"
 #include "cmValue.h"
 
 /** \class cmPropertyMap
  * \brief String property map.
+ *
+ * Properties are kept in a vector sorted by name.  Names are interned,
+ * so the many maps that hold the same builtin properties store one
+ * pointer per entry instead of a copy of the name.  Values
+ * are cm::String instances, so copies of a map share their buffers,
+ * and well-known values such as "ON" share one buffer process-wide.
  */
 class cmPropertyMap
 {
@@ -50,5 +57,16 @@ public:
   std::vector<std::pair<std::string, std::string>> GetList() const;
 
 private:
-  std::unordered_map<std::string, std::string> Map_;
+  struct Entry
+  {
+    cmInternedString Key;
+    cm::String Value;
+  };
+  using EntryVector = std::vector<Entry>;
+
+  EntryVector::iterator Find(const std::string& name);
+  EntryVector::const_iterator Find(const std::string& name) const;
+  cm::String& Emplace(const std::string& name);
+
+  EntryVector Entries_;
 };
@@ -285,24 +285,33 @@ bool cmSourceFile::Matches(cmSourceFileLocation const& loc)
   return this->Location.Matches(loc);
 }
 
+cmListFileBacktrace cmSourceFile::GetEntryBacktrace() const
+{
+  cmMakefile const* mf = this->Location.GetMakefile();
+  if (mf->GetCMakeInstance()->GetDiscardBacktraces()) {
+    return cmListFileBacktrace();
+  }
+  return mf->GetBacktrace();
+}
+
 void cmSourceFile::SetProperty(const std::string& prop, cmValue value)
 {
   if (prop == propINCLUDE_DIRECTORIES) {
     this->IncludeDirectories.clear();
     if (value) {
-      cmListFileBacktrace lfbt = this->Location.GetMakefile()->GetBacktrace();
+      cmListFileBacktrace lfbt = this->GetEntryBacktrace();
       this->IncludeDirectories.emplace_back(value, lfbt);
     }
   } else if (prop == propCOMPILE_OPTIONS) {
     this->CompileOptions.clear();
     if (value) {
-      cmListFileBacktrace lfbt = this->Location.GetMakefile()->GetBacktrace();
+      cmListFileBacktrace lfbt = this->GetEntryBacktrace();
       this->CompileOptions.emplace_back(value, lfbt);
     }
   } else if (prop == propCOMPILE_DEFINITIONS) {
     this->CompileDefinitions.clear();
     if (value) {
-      cmListFileBacktrace lfbt = this->Location.GetMakefile()->GetBacktrace();
+      cmListFileBacktrace lfbt = this->GetEntryBacktrace();
       this->CompileDefinitions.emplace_back(value, lfbt);
     }
   } else {
@@ -315,17 +324,17 @@ void cmSourceFile::AppendProperty(const std::string& prop,
 {
   if (prop == propINCLUDE_DIRECTORIES) {
     if (!value.empty()) {
-      cmListFileBacktrace lfbt = this->Location.GetMakefile()->GetBacktrace();
+      cmListFileBacktrace lfbt = this->GetEntryBacktrace();
       this->IncludeDirectories.emplace_back(value, lfbt);
     }
   } else if (prop == propCOMPILE_OPTIONS) {
     if (!value.empty()) {
-      cmListFileBacktrace lfbt = this->Location.GetMakefile()->GetBacktrace();
+      cmListFileBacktrace lfbt = this->GetEntryBacktrace();
       this->CompileOptions.emplace_back(value, lfbt);
     }
   } else if (prop == propCOMPILE_DEFINITIONS) {
     if (!value.empty()) {
-      cmListFileBacktrace lfbt = this->Location.GetMakefile()->GetBacktrace();
+      cmListFileBacktrace lfbt = this->GetEntryBacktrace();
       this->CompileDefinitions.emplace_back(value, lfbt);
     }
   } else {
@@ -170,6 +170,8 @@ private:
   bool FindFullPathFailed = false;
   bool IsGenerated = false;
 
+  cmListFileBacktrace GetEntryBacktrace() const;
+
   bool FindFullPath(std::string* error, std::string* cmp0115Warning);
   void CheckExtension();
   void CheckLanguage(std::string const& ext);
@@ -4,13 +4,13 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <utility>
 
 #include <cm/memory>
-
-#include "cmsys/RegularExpression.hxx"
+#include <cm/string_view>
 
 #include "cmCacheManager.h"
 #include "cmCommand.h"
@@ -18,6 +18,7 @@
 #include "cmExecutionStatus.h"
 #include "cmGlobCacheEntry.h"
 #include "cmGlobVerificationManager.h"
+#include "cmInternedString.h"
 #include "cmList.h"
 #include "cmListFileCache.h"
 #include "cmMakefile.h"
@@ -28,8 +29,16 @@
 #include "cmSystemTools.h"
 #include "cmake.h"
 
+static std::size_t NextCommandGeneration()
+{
+  // Generation 0 marks a function whose command was never resolved.
+  static std::atomic<std::size_t> generation{ 0 };
+  return ++generation;
+}
+
 cmState::cmState(Mode mode, ProjectKind projectKind)
-  : StateMode(mode)
+  : CommandGeneration(NextCommandGeneration())
+  , StateMode(mode)
   , StateProjectKind(projectKind)
 {
   this->CacheManager = cm::make_unique<cmCacheManager>();
@@ -331,6 +340,40 @@ cmStateSnapshot cmState::Reset()
   return { this, pos };
 }
 
+bool cmState::ParseListFile(std::string const& path, cmListFile& listFile,
+                            cmMessenger* messenger,
+                            cmListFileBacktrace const& lfbt)
+{
+  cmFileTime modifiedTime;
+  bool const haveTime = modifiedTime.Load(path);
+
+  auto it = this->ParsedListFiles.find(path);
+  if (haveTime && it != this->ParsedListFiles.end() &&
+      it->second.ModifiedTime.Equal(modifiedTime)) {
+    listFile.Functions = it->second.Functions;
+    return true;
+  }
+
+  if (!listFile.ParseFile(path.c_str(), messenger, lfbt)) {
+    this->ParsedListFiles.erase(path);
+    return false;
+  }
+
+  // Only reuse the result if the file was last modified at least a
+  // second before it was parsed.  A later modification within the
+  // resolution of the file system's timestamps would go undetected.
+  cmFileTime now;
+  now.LoadCurrentTime();
+  if (haveTime && listFile.Reusable && modifiedTime.OlderS(now)) {
+    ParsedListFile& parsed = this->ParsedListFiles[path];
+    parsed.ModifiedTime = modifiedTime;
+    parsed.Functions = listFile.Functions;
+  } else {
+    this->ParsedListFiles.erase(path);
+  }
+  return true;
+}
+
 void cmState::DefineProperty(const std::string& name,
                              cmProperty::ScopeType scope,
                              const std::string& ShortDescription,
@@ -408,6 +451,7 @@ void cmState::AddBuiltinCommand(std::string const& name, Command command)
   assert(name == cmSystemTools::LowerCase(name));
   assert(this->BuiltinCommands.find(name) == this->BuiltinCommands.end());
   this->BuiltinCommands.emplace(name, std::move(command));
+  this->CommandGeneration = NextCommandGeneration();
 }
 
 static bool InvokeBuiltinCommand(cmState::BuiltinCommand command,
@@ -526,6 +570,7 @@ bool cmState::AddScriptedCommand(std::string const& name, BT<Command> command,
   }
 
   this->ScriptedCommands[sName] = std::move(command.Value);
+  this->CommandGeneration = NextCommandGeneration();
   return true;
 }
 
@@ -535,18 +580,43 @@ cmState::Command cmState::GetCommand(std::string const& name) const
 }
 
 cmState::Command cmState::GetCommandByExactName(std::string const& name) const
+{
+  if (Command const* command = this->FindCommand(name)) {
+    return *command;
+  }
+  return nullptr;
+}
+
+cmState::Command const* cmState::FindCommand(std::string const& name) const
 {
   auto pos = this->ScriptedCommands.find(name);
   if (pos != this->ScriptedCommands.end()) {
-    return pos->second;
+    return &pos->second;
   }
   pos = this->BuiltinCommands.find(name);
   if (pos != this->BuiltinCommands.end()) {
-    return pos->second;
+    return &pos->second;
   }
   return nullptr;
 }
 
+cmState::Command cmState::ResolveCommand(cmListFileFunction const& lff) const
+{
+  // The commands are only added, replaced or removed together with a
+  // change of generation, so the pointer into the maps stays valid as
+  // long as the generation it was resolved against.
+  Command const* command;
+  if (!lff.GetResolvedCommand(this->CommandGeneration, command)) {
+    command = this->FindCommand(lff.LowerCaseName());
+    lff.SetResolvedCommand(this->CommandGeneration, command);
+  }
+  if (!command) {
+    return nullptr;
+  }
+  // Return a copy: the command may replace itself while it runs.
+  return *command;
+}
+
 std::vector<std::string> cmState::GetCommandNames() const
 {
   std::vector<std::string> commandNames;
@@ -568,11 +638,13 @@ void cmState::RemoveBuiltinCommand(std::string const& name)
 {
   assert(name == cmSystemTools::LowerCase(name));
   this->BuiltinCommands.erase(name);
+  this->CommandGeneration = NextCommandGeneration();
 }
 
 void cmState::RemoveUserDefinedCommands()
 {
   this->ScriptedCommands.clear();
+  this->CommandGeneration = NextCommandGeneration();
 }
 
 void cmState::SetGlobalProperty(const std::string& prop,
@@ -922,7 +994,7 @@ cmStateSnapshot cmState::CreateDeferCallSnapshot(
 }
 
 cmStateSnapshot cmState::CreateFunctionCallSnapshot(
-  cmStateSnapshot const& originSnapshot, std::string const& fileName)
+  cmStateSnapshot const& originSnapshot, cmInternedString fileName)
 {
   cmStateDetail::PositionType pos =
     this->SnapshotData.Push(originSnapshot.Position, *originSnapshot.Position);
@@ -941,7 +1013,7 @@ cmStateSnapshot cmState::CreateFunctionCallSnapshot(
 }
 
 cmStateSnapshot cmState::CreateMacroCallSnapshot(
-  cmStateSnapshot const& originSnapshot, std::string const& fileName)
+  cmStateSnapshot const& originSnapshot, cmInternedString fileName)
 {
   cmStateDetail::PositionType pos =
     this->SnapshotData.Push(originSnapshot.Position, *originSnapshot.Position);
@@ -1047,71 +1119,82 @@ cmStateSnapshot cmState::Pop(cmStateSnapshot const& originSnapshot)
   return { this, prevPos };
 }
 
-static bool ParseEntryWithoutType(const std::string& entry, std::string& var,
-                                  std::string& value)
-{
-  // input line is:         key=value
-  static cmsys::RegularExpression reg(
-    "^([^=]*)=(.*[^\r\t ]|[\r\t ]*)[\r\t ]*$");
-  // input line is:         "key"=value
-  static cmsys::RegularExpression regQuoted(
-    "^\"([^\"]*)\"=(.*[^\r\t ]|[\r\t ]*)[\r\t ]*$");
-  bool flag = false;
-  if (regQuoted.find(entry)) {
-    var = regQuoted.match(1);
-    value = regQuoted.match(2);
-    flag = true;
-  } else if (reg.find(entry)) {
-    var = reg.match(1);
-    value = reg.match(2);
-    flag = true;
+namespace {
+// Split a "key<sep>rest" cache entry line.  A quoted key may hold the
+// separator characters.  An unquoted key ends at the first separator or
+// '=', which must then be the separator.
+bool SplitCacheEntryKey(cm::string_view entry, char sep, bool quoted,
+                        cm::string_view& key, cm::string_view& rest)
+{
+  if (quoted) {
+    if (entry.empty() || entry.front() != '"') {
+      return false;
+    }
+    cm::string_view::size_type const q = entry.find('"', 1);
+    if (q == cm::string_view::npos || q + 1 >= entry.size() ||
+        entry[q + 1] != sep) {
+      return false;
+    }
+    key = entry.substr(1, q - 1);
+    rest = entry.substr(q + 2);
+    return true;
+  }
+  char const seps[] = { sep, '=', '\0' };
+  cm::string_view::size_type const pos = entry.find_first_of(seps);
+  if (pos == cm::string_view::npos || entry[pos] != sep) {
+    return false;
   }
+  key = entry.substr(0, pos);
+  rest = entry.substr(pos + 1);
+  return true;
+}
 
-  // if value is enclosed in single quotes ('foo') then remove them
-  // it is used to enclose trailing space or tab
-  if (flag && value.size() >= 2 && value.front() == '\'' &&
-      value.back() == '\'') {
+// Drop trailing blanks and the single quotes that protect them.
+std::string CacheEntryValue(cm::string_view value)
+{
+  // Trailing blanks are dropped, but a value of only blanks is kept.
+  cm::string_view::size_type const last = value.find_last_not_of("\r\t ");
+  if (last != cm::string_view::npos) {
+    value = value.substr(0, last + 1);
+  }
+  if (value.size() >= 2 && value.front() == '\'' && value.back() == '\'') {
     value = value.substr(1, value.size() - 2);
   }
-
-  return flag;
+  return std::string(value);
+}
 }
 
 bool cmState::ParseCacheEntry(const std::string& entry, std::string& var,
                               std::string& value,
                               cmStateEnums::CacheEntryType& type)
 {
-  // input line is:         key:type=value
-  static cmsys::RegularExpression reg(
-    "^([^=:]*):([^=]*)=(.*[^\r\t ]|[\r\t ]*)[\r\t ]*$");
-  // input line is:         "key":type=value
-  static cmsys::RegularExpression regQuoted(
-    "^\"([^\"]*)\":([^=]*)=(.*[^\r\t ]|[\r\t ]*)[\r\t ]*$");
-  bool flag = false;
-  if (regQuoted.find(entry)) {
-    var = regQuoted.match(1);
-    type = cmState::StringToCacheEntryType(regQuoted.match(2));
-    value = regQuoted.match(3);
-    flag = true;
-  } else if (reg.find(entry)) {
-    var = reg.match(1);
-    type = cmState::StringToCacheEntryType(reg.match(2));
-    value = reg.match(3);
-    flag = true;
-  }
-
-  // if value is enclosed in single quotes ('foo') then remove them
-  // it is used to enclose trailing space or tab
-  if (flag && value.size() >= 2 && value.front() == '\'' &&
-      value.back() == '\'') {
-    value = value.substr(1, value.size() - 2);
+  cm::string_view key;
+  cm::string_view rest;
+
+  // input line is:         key:type=value  or  "key":type=value
+  for (bool quoted : { true, false }) {
+    if (SplitCacheEntryKey(entry, ':', quoted, key, rest)) {
+      cm::string_view::size_type const eq = rest.find('=');
+      if (eq != cm::string_view::npos) {
+        var = std::string(key);
+        type =
+          cmState::StringToCacheEntryType(std::string(rest.substr(0, eq)));
+        value = CacheEntryValue(rest.substr(eq + 1));
+        return true;
+      }
+    }
   }
 
-  if (!flag) {
-    return ParseEntryWithoutType(entry, var, value);
+  // input line is:         key=value  or  "key"=value
+  for (bool quoted : { true, false }) {
+    if (SplitCacheEntryKey(entry, '=', quoted, key, rest)) {
+      var = std::string(key);
+      value = CacheEntryValue(rest);
+      return true;
+    }
   }
 
-  return flag;
+  return false;
 }
 
 cmState::Command cmState::GetDependencyProviderCommand(
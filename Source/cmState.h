@@ -4,6 +4,7 @@
 
 #include "cmConfigure.h" // IWYU pragma: keep
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <set>
@@ -17,7 +18,10 @@
 
 #include "cmDefinitions.h"
 #include "cmDependencyProvider.h"
+#include "cmFileTime.h"
+#include "cmInternedString.h"
 #include "cmLinkedTree.h"
+#include "cmListFileCache.h"
 #include "cmPolicies.h"
 #include "cmProperty.h"
 #include "cmPropertyDefinition.h"
@@ -33,12 +37,7 @@ class cmMakefile;
 class cmStateSnapshot;
 class cmMessenger;
 class cmExecutionStatus;
-class cmListFileBacktrace;
 struct cmGlobCacheEntry;
-struct cmListFileArgument;
-
-template <typename T>
-class BT;
 
 class cmState
 {
@@ -77,9 +76,9 @@ public:
   cmStateSnapshot CreateDeferCallSnapshot(
     cmStateSnapshot const& originSnapshot, std::string const& fileName);
   cmStateSnapshot CreateFunctionCallSnapshot(
-    cmStateSnapshot const& originSnapshot, std::string const& fileName);
+    cmStateSnapshot const& originSnapshot, cmInternedString fileName);
   cmStateSnapshot CreateMacroCallSnapshot(
-    cmStateSnapshot const& originSnapshot, std::string const& fileName);
+    cmStateSnapshot const& originSnapshot, cmInternedString fileName);
   cmStateSnapshot CreateIncludeFileSnapshot(
     cmStateSnapshot const& originSnapshot, std::string const& fileName);
   cmStateSnapshot CreateVariableScopeSnapshot(
@@ -140,6 +139,15 @@ public:
                               cmStateEnums::CacheEntryType& type);
 
   cmStateSnapshot Reset();
+
+  /**
+   * Parse the list file at the given full path into listFile.  A file
+   * parsed earlier in this process is not parsed again unless it has
+   * been modified since.
+   */
+  bool ParseListFile(std::string const& path, cmListFile& listFile,
+                     cmMessenger* messenger, cmListFileBacktrace const& lfbt);
+
   // Define a property
   void DefineProperty(const std::string& name, cmProperty::ScopeType scope,
                       const std::string& ShortDescription,
@@ -176,6 +184,8 @@ public:
   Command GetCommand(std::string const& name) const;
   // Returns a command from its name, or nullptr
   Command GetCommandByExactName(std::string const& name) const;
+  // Returns the command invoked by a function, or nullptr
+  Command ResolveCommand(cmListFileFunction const& lff) const;
 
   void AddBuiltinCommand(std::string const& name,
                          std::unique_ptr<cmCommand> command);
@@ -272,19 +282,31 @@ private:
                          cmMessenger* messenger);
   std::vector<cmGlobCacheEntry> GetGlobCacheEntries() const;
 
+  // Returns the stored command with the exact name, or nullptr
+  Command const* FindCommand(std::string const& name) const;
+
   cmPropertyDefinitionMap PropertyDefinitions;
   std::vector<std::string> EnabledLanguages;
   std::unordered_map<std::string, Command> BuiltinCommands;
   std::unordered_map<std::string, Command> ScriptedCommands;
+  // Identifies the current set of commands, unique across all instances.
+  std::size_t CommandGeneration;
   std::unordered_set<std::string> FlowControlCommands;
   cmPropertyMap GlobalProperties;
   std::unique_ptr<cmCacheManager> CacheManager;
   std::unique_ptr<cmGlobVerificationManager> GlobVerificationManager;
 
+  struct ParsedListFile
+  {
+    cmFileTime ModifiedTime;
+    std::vector<cmListFileFunction> Functions;
+  };
+  std::unordered_map<std::string, ParsedListFile> ParsedListFiles;
+
   cmLinkedTree<cmStateDetail::BuildsystemDirectoryStateType>
     BuildsystemDirectory;
 
-  cmLinkedTree<std::string> ExecutionListFiles;
+  cmLinkedTree<cmInternedString> ExecutionListFiles;
 
   cmLinkedTree<cmStateDetail::PolicyStackEntry> PolicyStack;
   cmLinkedTree<cmStateDetail::SnapshotDataType> SnapshotData;
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "cmDefinitions.h"
+#include "cmInternedString.h"
 #include "cmLinkedTree.h"
 #include "cmListFileCache.h"
 #include "cmPolicies.h"
@@ -32,7 +33,7 @@ struct cmStateDetail::SnapshotDataType
   cmLinkedTree<cmStateDetail::PolicyStackEntry>::iterator PolicyScope;
   cmStateEnums::SnapshotType SnapshotType;
   bool Keep;
-  cmLinkedTree<std::string>::iterator ExecutionListFile;
+  cmLinkedTree<cmInternedString>::iterator ExecutionListFile;
   cmLinkedTree<cmStateDetail::BuildsystemDirectoryStateType>::iterator
     BuildSystemDirectory;
   cmLinkedTree<cmDefinitions>::iterator Vars;
@@ -51,7 +51,7 @@ void cmStateSnapshot::SetListFile(const std::string& listfile)
   *this->Position->ExecutionListFile = listfile;
 }
 
-std::string const& cmStateSnapshot::GetExecutionListFile() const
+cmInternedString cmStateSnapshot::GetExecutionListFile() const
 {
   return *this->Position->ExecutionListFile;
 }
@@ -224,6 +224,13 @@ void cmStateSnapshot::SetDefinition(std::string const& name,
   this->Position->Vars->Set(name, value);
 }
 
+bool cmStateSnapshot::AppendDefinition(std::string const& name,
+                                       cm::string_view value)
+{
+  return cmDefinitions::Append(name, value, this->Position->Vars,
+                               this->Position->Root);
+}
+
 void cmStateSnapshot::RemoveDefinition(std::string const& name)
 {
   this->Position->Vars->Unset(name);
@@ -10,6 +10,7 @@
 
 #include <cm/string_view>
 
+#include "cmInternedString.h"
 #include "cmPolicies.h"
 #include "cmStateTypes.h"
 #include "cmValue.h"
@@ -26,13 +27,14 @@ public:
   cmValue GetDefinition(std::string const& name) const;
   bool IsInitialized(std::string const& name) const;
   void SetDefinition(std::string const& name, cm::string_view value);
+  bool AppendDefinition(std::string const& name, cm::string_view value);
   void RemoveDefinition(std::string const& name);
   std::vector<std::string> ClosureKeys() const;
   bool RaiseScope(std::string const& var, const char* varDef);
 
   void SetListFile(std::string const& listfile);
 
-  std::string const& GetExecutionListFile() const;
+  cmInternedString GetExecutionListFile() const;
 
   std::vector<cmStateSnapshot> GetChildren();
 
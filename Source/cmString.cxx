@@ -22,6 +22,23 @@ void String::internally_mutate_to_stable_string()
   *this = String(this->data(), this->size());
 }
 
+bool String::internally_append_to_owned_string(string_view v)
+{
+  // Only a buffer that we own alone and view entirely may be modified.
+  // Copies of this instance must keep seeing the old value.
+  if (!this->string_ || this->string_.use_count() != 1 ||
+      this->data() != this->string_->data() ||
+      this->size() != this->string_->size()) {
+    return false;
+  }
+
+  // The buffer was created as a mutable std::string by our constructor.
+  std::string& s = const_cast<std::string&>(*this->string_);
+  s.append(v.data(), v.size());
+  this->view_ = string_view(s.data(), s.size());
+  return true;
+}
+
 bool String::is_stable() const
 {
   return this->str_if_stable() != nullptr;
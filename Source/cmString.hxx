@@ -411,6 +411,9 @@ public:
     T&& s)
   {
     string_view v = AsStringView<T>::view(std::forward<T>(s));
+    if (this->internally_append_to_owned_string(v)) {
+      return *this;
+    }
     std::string r;
     r.reserve(this->size() + v.size());
     r.assign(this->data(), this->size());
@@ -429,6 +432,9 @@ public:
 
   void push_back(char ch)
   {
+    if (this->internally_append_to_owned_string(string_view(&ch, 1))) {
+      return;
+    }
     std::string s;
     s.reserve(this->size() + 1);
     s.assign(this->data(), this->size());
@@ -655,6 +661,9 @@ private:
 
   void internally_mutate_to_stable_string();
 
+  // Append in place if no other instance shares our string buffer.
+  bool internally_append_to_owned_string(string_view v);
+
   std::shared_ptr<std::string const> string_;
   string_view view_;
 };
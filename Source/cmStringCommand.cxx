@@ -37,6 +37,7 @@
 #include "cmTimestamp.h"
 #include "cmUuid.h"
 #include "cmValue.h"
+#include "cmake.h"
 
 namespace {
 
@@ -234,8 +235,10 @@ bool RegexMatch(std::vector<std::string> const& args,
 
   status.GetMakefile().ClearMatches();
   // Compile the regular expression.
-  cmsys::RegularExpression re;
-  if (!re.compile(regex)) {
+  std::shared_ptr<cmsys::RegularExpression const> const re =
+    status.GetMakefile().GetCMakeInstance()->GetCompiledRegularExpression(
+      regex);
+  if (!re->is_valid()) {
     std::string e =
       "sub-command REGEX, mode MATCH failed to compile regex \"" + regex +
       "\".";
@@ -248,10 +251,11 @@ bool RegexMatch(std::vector<std::string> const& args,
 
   // Scan through the input for all matches.
   std::string output;
-  if (re.find(input)) {
-    status.GetMakefile().StoreMatches(re);
-    std::string::size_type l = re.start();
-    std::string::size_type r = re.end();
+  cmsys::RegularExpressionMatch match;
+  if (re->find(input.c_str(), match)) {
+    status.GetMakefile().StoreMatches(match);
+    std::string::size_type l = match.start();
+    std::string::size_type r = match.end();
     if (r - l == 0) {
       std::string e = "sub-command REGEX, mode MATCH regex \"" + regex +
         "\" matched an empty string.";
@@ -276,8 +280,10 @@ bool RegexMatchAll(std::vector<std::string> const& args,
 
   status.GetMakefile().ClearMatches();
   // Compile the regular expression.
-  cmsys::RegularExpression re;
-  if (!re.compile(regex)) {
+  std::shared_ptr<cmsys::RegularExpression const> const re =
+    status.GetMakefile().GetCMakeInstance()->GetCompiledRegularExpression(
+      regex);
+  if (!re->is_valid()) {
     std::string e =
       "sub-command REGEX, mode MATCHALL failed to compile regex \"" + regex +
       "\".";
@@ -291,11 +297,12 @@ bool RegexMatchAll(std::vector<std::string> const& args,
   // Scan through the input for all matches.
   std::string output;
   const char* p = input.c_str();
-  while (re.find(p)) {
+  cmsys::RegularExpressionMatch match;
+  while (re->find(p, match)) {
     status.GetMakefile().ClearMatches();
-    status.GetMakefile().StoreMatches(re);
-    std::string::size_type l = re.start();
-    std::string::size_type r = re.end();
+    status.GetMakefile().StoreMatches(match);
+    std::string::size_type l = match.start();
+    std::string::size_type r = match.end();
     if (r - l == 0) {
       std::string e = "sub-command REGEX, mode MATCHALL regex \"" + regex +
         "\" matched an empty string.";
@@ -540,12 +547,15 @@ bool HandleAppendCommand(std::vector<std::string> const& args,
   }
 
   auto const& variableName = args[1];
+  cmMakefile& makefile = status.GetMakefile();
+  auto const value = cmJoin(cmMakeRange(args).advance(2), {});
 
-  cm::string_view oldView{ status.GetMakefile().GetSafeDefinition(
-    variableName) };
-
-  auto const newValue = cmJoin(cmMakeRange(args).advance(2), {}, oldView);
-  status.GetMakefile().AddDefinition(variableName, newValue);
+  // Extend an existing value in place instead of copying it.
+  if (makefile.GetDefinition(variableName)) {
+    makefile.AppendDefinition(variableName, value);
+  } else {
+    makefile.AddDefinition(variableName, value);
+  }
 
   return true;
 }
@@ -3,19 +3,28 @@
 
 #include "cmStringReplaceHelper.h"
 
+#include <memory>
 #include <sstream>
 #include <utility>
 
 #include "cmMakefile.h"
+#include "cmake.h"
 
 cmStringReplaceHelper::cmStringReplaceHelper(const std::string& regex,
                                              std::string replace_expr,
                                              cmMakefile* makefile)
   : RegExString(regex)
-  , RegularExpression(regex)
   , ReplaceExpression(std::move(replace_expr))
   , Makefile(makefile)
 {
+  // Share compiled patterns with other commands when called from a script.
+  if (this->Makefile) {
+    this->RegularExpression =
+      this->Makefile->GetCMakeInstance()->GetCompiledRegularExpression(regex);
+  } else {
+    this->RegularExpression =
+      std::make_shared<cmsys::RegularExpression const>(regex);
+  }
   this->ParseReplaceExpression();
 }
 
@@ -26,13 +35,14 @@ bool cmStringReplaceHelper::Replace(const std::string& input,
 
   // Scan through the input for all matches.
   std::string::size_type base = 0;
-  while (this->RegularExpression.find(input.c_str() + base)) {
+  cmsys::RegularExpressionMatch match;
+  while (this->RegularExpression->find(input.c_str() + base, match)) {
     if (this->Makefile != nullptr) {
       this->Makefile->ClearMatches();
-      this->Makefile->StoreMatches(this->RegularExpression);
+      this->Makefile->StoreMatches(match);
     }
-    auto l2 = this->RegularExpression.start();
-    auto r = this->RegularExpression.end();
+    auto l2 = match.start();
+    auto r = match.end();
 
     // Concatenate the part of the input that was not matched.
     output += input.substr(base, l2);
@@ -53,8 +63,8 @@ bool cmStringReplaceHelper::Replace(const std::string& input,
       } else {
         // Replace with part of the match.
         auto n = replacement.Number;
-        auto start = this->RegularExpression.start(n);
-        auto end = this->RegularExpression.end(n);
+        auto start = match.start(n);
+        auto end = match.end(n);
         auto len = input.length() - base;
         if ((start != std::string::npos) && (end != std::string::npos) &&
             (start <= len) && (end <= len)) {
@@ -2,6 +2,7 @@
    file Copyright.txt or https://cmake.org/licensing for details.  */
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -18,7 +19,7 @@ public:
 
   bool IsRegularExpressionValid() const
   {
-    return this->RegularExpression.is_valid();
+    return this->RegularExpression->is_valid();
   }
   bool IsReplaceExpressionValid() const
   {
@@ -57,7 +58,7 @@ private:
 
   std::string ErrorString;
   std::string RegExString;
-  cmsys::RegularExpression RegularExpression;
+  std::shared_ptr<cmsys::RegularExpression const> RegularExpression;
   bool ValidReplaceExpression = true;
   std::string ReplaceExpression;
   std::vector<RegexReplacement> Replacements;
@@ -70,6 +70,7 @@
 #include <ctime>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -1328,6 +1329,42 @@ void cmSystemTools::MoveFileIfDifferent(const std::string& source,
   RemoveFile(source);
 }
 
+bool cmSystemTools::ReadWholeFile(std::string const& path,
+                                  std::string& content)
+{
+  cmsys::ifstream fin(path.c_str(), std::ios::in | std::ios::binary);
+  if (!fin) {
+    return false;
+  }
+  content.assign(std::istreambuf_iterator<char>(fin),
+                 std::istreambuf_iterator<char>());
+  return !fin.bad();
+}
+
+bool cmSystemTools::WriteFileAtomically(std::string const& path,
+                                        std::string const& content)
+{
+  std::string const tmp =
+    cmStrCat(path, '.', cmSystemTools::RandomSeed(), ".tmp");
+  {
+    cmsys::ofstream fout(tmp.c_str(), std::ios::out | std::ios::binary);
+    if (!fout) {
+      return false;
+    }
+    fout.write(content.data(), content.size());
+    if (!fout) {
+      fout.close();
+      cmSystemTools::RemoveFile(tmp);
+      return false;
+    }
+  }
+  if (!cmSystemTools::RenameFile(tmp, path)) {
+    cmSystemTools::RemoveFile(tmp);
+    return false;
+  }
+  return true;
+}
+
 void cmSystemTools::Glob(const std::string& directory,
                          const std::string& regexp,
                          std::vector<std::string>& files)
@@ -214,6 +214,14 @@ public:
   static void MoveFileIfDifferent(const std::string& source,
                                   const std::string& destination);
 
+  //! Read the whole content of a file without newline conversion
+  static bool ReadWholeFile(std::string const& path, std::string& content);
+
+  /** Write a file through a temporary file that is renamed into place,
+      so that concurrent readers never observe partial content.  */
+  static bool WriteFileAtomically(std::string const& path,
+                                  std::string const& content);
+
   /**
    * Run a single executable command
    *
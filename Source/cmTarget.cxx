@@ -268,7 +268,8 @@ struct UsageRequirementProperty
   void WriteDirect(cmTargetInternals const* impl,
                    cm::optional<cmListFileBacktrace> const& bt,
                    ValueType value, Action action);
-  void WriteDirect(BT<std::string> value, Action action);
+  void WriteDirect(cmTargetInternals const* impl, BT<std::string> value,
+                   Action action);
   std::pair<bool, cmValue> Read(const std::string& prop) const;
 
   cm::static_string_view const Name;
@@ -718,9 +719,19 @@ public:
   cmValue GetFileSetPaths(cmTarget const* self, std::string const& fileSetName,
                           cm::string_view fileSetType) const;
 
+  // Backtraces recorded on entries are used only by diagnostics and
+  // the file API, and would keep the call stacks of every command alive.
+  bool DiscardBacktraces() const
+  {
+    return this->Makefile->GetCMakeInstance()->GetDiscardBacktraces();
+  }
+
   cmListFileBacktrace GetBacktrace(
-    cm::optional<cmListFileBacktrace> const& bt) const
+    cm::optional<cmListFileBacktrace> const& bt = {}) const
   {
+    if (this->DiscardBacktraces()) {
+      return cmListFileBacktrace();
+    }
     return bt ? *bt : this->Makefile->GetBacktrace();
   }
 };
@@ -890,9 +901,13 @@ void UsageRequirementProperty::WriteDirect(
   }
 }
 
-void UsageRequirementProperty::WriteDirect(BT<std::string> value,
+void UsageRequirementProperty::WriteDirect(cmTargetInternals const* impl,
+                                           BT<std::string> value,
                                            Action action)
 {
+  if (impl->DiscardBacktraces()) {
+    value.Backtrace = cmListFileBacktrace();
+  }
   if (action == Action::Set) {
     this->Entries.clear();
   }
@@ -2240,7 +2255,7 @@ void cmTarget::SetProperty(const std::string& prop, cmValue value)
              prop == propOBJC_STANDARD || prop == propOBJCXX_STANDARD) {
     if (value) {
       this->impl->LanguageStandardProperties[prop] =
-        BTs<std::string>(value, this->impl->Makefile->GetBacktrace());
+        BTs<std::string>(value, this->impl->GetBacktrace());
     } else {
       this->impl->LanguageStandardProperties.erase(prop);
     }
@@ -2353,7 +2368,7 @@ void cmTargetInternals::AddDirectoryToFileSet(cmTarget* self,
   }
   if (cmNonempty(value)) {
     fileSet->AddDirectoryEntry(
-      BT<std::string>(value, this->Makefile->GetBacktrace()));
+      BT<std::string>(value, this->GetBacktrace()));
   }
 }
 
@@ -2384,7 +2399,7 @@ void cmTargetInternals::AddPathToFileSet(cmTarget* self,
   }
   if (cmNonempty(value)) {
     fileSet->AddFileEntry(
-      BT<std::string>(value, this->Makefile->GetBacktrace()));
+      BT<std::string>(value, this->GetBacktrace()));
   }
 }
 
@@ -2545,7 +2560,7 @@ void cmTarget::FinalizeTargetConfiguration(
 void cmTarget::InsertInclude(BT<std::string> const& entry, bool before)
 {
   this->impl->IncludeDirectories.WriteDirect(
-    entry,
+    this->impl.get(), entry,
     before ? UsageRequirementProperty::Action::Prepend
            : UsageRequirementProperty::Action::Append);
 }
@@ -2553,7 +2568,7 @@ void cmTarget::InsertInclude(BT<std::string> const& entry, bool before)
 void cmTarget::InsertCompileOption(BT<std::string> const& entry, bool before)
 {
   this->impl->CompileOptions.WriteDirect(
-    entry,
+    this->impl.get(), entry,
     before ? UsageRequirementProperty::Action::Prepend
            : UsageRequirementProperty::Action::Append);
 }
@@ -2561,13 +2576,13 @@ void cmTarget::InsertCompileOption(BT<std::string> const& entry, bool before)
 void cmTarget::InsertCompileDefinition(BT<std::string> const& entry)
 {
   this->impl->CompileDefinitions.WriteDirect(
-    entry, UsageRequirementProperty::Action::Append);
+    this->impl.get(), entry, UsageRequirementProperty::Action::Append);
 }
 
 void cmTarget::InsertLinkOption(BT<std::string> const& entry, bool before)
 {
   this->impl->LinkOptions.WriteDirect(
-    entry,
+    this->impl.get(), entry,
     before ? UsageRequirementProperty::Action::Prepend
            : UsageRequirementProperty::Action::Append);
 }
@@ -2575,7 +2590,7 @@ void cmTarget::InsertLinkOption(BT<std::string> const& entry, bool before)
 void cmTarget::InsertLinkDirectory(BT<std::string> const& entry, bool before)
 {
   this->impl->LinkDirectories.WriteDirect(
-    entry,
+    this->impl.get(), entry,
     before ? UsageRequirementProperty::Action::Prepend
            : UsageRequirementProperty::Action::Append);
 }
@@ -2583,7 +2598,7 @@ void cmTarget::InsertLinkDirectory(BT<std::string> const& entry, bool before)
 void cmTarget::InsertPrecompileHeader(BT<std::string> const& entry)
 {
   this->impl->PrecompileHeaders.WriteDirect(
-    entry, UsageRequirementProperty::Action::Append);
+    this->impl.get(), entry, UsageRequirementProperty::Action::Append);
 }
 
 namespace {
@@ -1098,6 +1098,11 @@ void cmake::SetArgs(const std::vector<std::string>& args)
                        state->SetDebugOutputOn(true);
                        return true;
                      } },
+    CommandArgument{ "--discard-backtraces", CommandArgument::Values::Zero,
+                     [](std::string const&, cmake* state) -> bool {
+                       state->SetDiscardBacktraces(true);
+                       return true;
+                     } },
 
     CommandArgument{ "--log-level", "Invalid level specified for --log-level",
                      CommandArgument::Values::One,
@@ -2554,6 +2559,10 @@ int cmake::ActualConfigure()
   this->FileAPI = cm::make_unique<cmFileAPI>(this);
   this->FileAPI->ReadQueries();
 
+  // The codemodel reply describes where usage requirements come from.
+  this->DiscardBacktraces =
+    this->DiscardBacktracesRequested && !this->FileAPI->HasQueries();
+
   if (!this->GetIsInTryCompile()) {
     this->TruncateOutputLog("CMakeConfigureLog.yaml");
     this->ConfigureLog = cm::make_unique<cmConfigureLog>(
@@ -3144,6 +3153,31 @@ bool cmake::DeleteCache(const std::string& path)
   return this->State->DeleteCache(path);
 }
 
+std::shared_ptr<cmsys::RegularExpression const>
+cmake::GetCompiledRegularExpression(std::string const& regex)
+{
+  auto it = this->CompiledRegularExpressions.find(regex);
+  bool const hit = it != this->CompiledRegularExpressions.end();
+#ifndef CMAKE_BOOTSTRAP
+  if (this->IsProfilingEnabled()) {
+    this->GetProfilingOutput().IncrementCounter("regex_cache",
+                                                hit ? "hits" : "misses");
+  }
+#endif
+  if (hit) {
+    return it->second;
+  }
+
+  // Patterns built from changing input would grow the map without bound.
+  // Start over once it holds far more than a project normally uses.
+  if (this->CompiledRegularExpressions.size() >= 4096) {
+    this->CompiledRegularExpressions.clear();
+  }
+  auto re = std::make_shared<cmsys::RegularExpression>(regex);
+  this->CompiledRegularExpressions.emplace(regex, re);
+  return re;
+}
+
 void cmake::SetProgressCallback(ProgressCallbackType f)
 {
   this->ProgressCallback = std::move(f);
@@ -10,6 +10,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -17,6 +18,8 @@
 #include <cm/string_view>
 #include <cmext/string_view>
 
+#include "cmsys/RegularExpression.hxx"
+
 #include "cmDocumentationEntry.h" // IWYU pragma: keep
 #include "cmGeneratedFileStream.h"
 #include "cmGlobalGeneratorFactory.h"
@@ -37,6 +40,7 @@
 #  include "cmMakefileProfilingData.h"
 #endif
 
+struct cmCompiledCondition;
 class cmConfigureLog;
 
 #ifdef CMake_ENABLE_DEBUGGER
@@ -49,6 +53,7 @@ class cmExternalMakefileProjectGeneratorFactory;
 class cmFileAPI;
 class cmFileTimeCache;
 class cmGlobalGenerator;
+struct cmGeneratorExpressionParseTree;
 class cmMakefile;
 class cmMessenger;
 class cmVariableWatch;
@@ -459,6 +464,38 @@ public:
    */
   cmFileTimeCache* GetFileTimeCache() { return this->FileTimeCache.get(); }
 
+  /**
+   * Get the generator expression parse trees, keyed by input string
+   */
+  using GeneratorExpressionParseTreeMap =
+    std::unordered_map<cm::string_view,
+                       std::shared_ptr<cmGeneratorExpressionParseTree const>>;
+  GeneratorExpressionParseTreeMap& GetGeneratorExpressionParseTrees()
+  {
+    return this->GeneratorExpressionParseTrees;
+  }
+
+  /**
+   * Get the compiled form of a regular expression.  Patterns are compiled
+   * once per cmake instance and shared by all callers, so check is_valid()
+   * to see whether the pattern compiled and keep match results in a
+   * cmsys::RegularExpressionMatch of your own.
+   */
+  std::shared_ptr<cmsys::RegularExpression const>
+  GetCompiledRegularExpression(std::string const& regex);
+
+  /**
+   * Get the compiled if() and while() conditions, keyed by the keyword
+   * positions of their arguments and the policies that affect them
+   */
+  using CompiledConditionMap =
+    std::unordered_map<std::string,
+                       std::shared_ptr<cmCompiledCondition const>>;
+  CompiledConditionMap& GetCompiledConditions()
+  {
+    return this->CompiledConditions;
+  }
+
   bool WasLogLevelSetViaCLI() const { return this->LogLevelWasSetViaCLI; }
 
   //! Get the selected log level for `message()` commands during the cmake run.
@@ -548,6 +585,10 @@ public:
   bool GetIgnoreWarningAsError() const { return this->IgnoreWarningAsError; }
   void SetIgnoreWarningAsError(bool b) { this->IgnoreWarningAsError = b; }
 
+  //! Do we drop the backtraces of target properties and usage requirements.
+  bool GetDiscardBacktraces() const { return this->DiscardBacktraces; }
+  void SetDiscardBacktraces(bool b) { this->DiscardBacktracesRequested = b; }
+
   void MarkCliAsUsed(const std::string& variable);
 
   /** Get the list of configurations (in upper case) considered to be
@@ -758,6 +799,8 @@ private:
   bool WarnUnusedCli = true;
   bool CheckSystemVars = false;
   bool IgnoreWarningAsError = false;
+  bool DiscardBacktracesRequested = false;
+  bool DiscardBacktraces = false;
   std::map<std::string, bool> UsedCliVariables;
   std::string CMakeEditCommand;
   std::string CXXEnvironment;
@@ -778,6 +821,11 @@ private:
   bool FreshCache = false;
   bool RegenerateDuringBuild = false;
   std::unique_ptr<cmFileTimeCache> FileTimeCache;
+  GeneratorExpressionParseTreeMap GeneratorExpressionParseTrees;
+  std::unordered_map<std::string,
+                     std::shared_ptr<cmsys::RegularExpression const>>
+    CompiledRegularExpressions;
+  CompiledConditionMap CompiledConditions;
   std::string GraphVizFile;
   InstalledFilesMap InstalledFiles;
 #ifndef CMAKE_BOOTSTRAP
@@ -68,7 +68,7 @@ const cmDocumentationEntry cmDocumentationUsageNote = {
   "Run 'cmake --help' for more information."
 };
 
-const cmDocumentationEntry cmDocumentationOptions[31] = {
+const cmDocumentationEntry cmDocumentationOptions[32] = {
   { "--preset <preset>,--preset=<preset>", "Specify a configure preset." },
   { "--list-presets[=<type>]", "List available presets." },
   { "-E", "CMake command mode." },
@@ -93,6 +93,8 @@ const cmDocumentationEntry cmDocumentationOptions[31] = {
     "Do not delete the try_compile build tree. Only "
     "useful on one try_compile at a time." },
   { "--debug-output", "Put cmake in a debug mode." },
+  { "--discard-backtraces",
+    "Do not record where target properties are set." },
   { "--debug-find", "Put cmake find in a debug mode." },
   { "--debug-find-pkg=<pkg-name>[,...]",
     "Limit cmake debug-find to the comma-separated list of packages" },
@@ -0,0 +1,191 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file Copyright.txt or https://cmake.org/licensing for details.  */
+
+#include <chrono>
+#include <cstddef>
+#include <ios>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <string>
+
+#include "cmsys/FStream.hxx"
+
+#include "cmCacheManager.h"
+#include "cmFileTimes.h"
+#include "cmState.h"
+#include "cmStateTypes.h"
+#include "cmStringAlgorithms.h"
+#include "cmSystemTools.h"
+#include "cmValue.h"
+
+#include "testCommon.h"
+
+namespace {
+
+bool parse(std::string const& entry, std::string const& expectedKey,
+           std::string const& expectedValue,
+           cmStateEnums::CacheEntryType expectedType)
+{
+  std::string key;
+  std::string value;
+  cmStateEnums::CacheEntryType type = cmStateEnums::UNINITIALIZED;
+  if (!cmState::ParseCacheEntry(entry, key, value, type)) {
+    std::cout << "failed to parse: " << entry << '\n';
+    return false;
+  }
+  if (key != expectedKey || value != expectedValue || type != expectedType) {
+    std::cout << "wrong result for: " << entry << "\n  key: " << key
+              << "\n  value: " << value << '\n';
+    return false;
+  }
+  return true;
+}
+
+bool testParseCacheEntry()
+{
+  std::cout << "testParseCacheEntry()\n";
+
+  auto const STRING = cmStateEnums::STRING;
+  auto const UNINITIALIZED = cmStateEnums::UNINITIALIZED;
+  ASSERT_TRUE(parse("A:STRING=b", "A", "b", STRING));
+  ASSERT_TRUE(parse("A:BOOL=ON", "A", "ON", cmStateEnums::BOOL));
+  ASSERT_TRUE(parse("A:STRING=", "A", "", STRING));
+  ASSERT_TRUE(parse("A:STRING=b=c:d", "A", "b=c:d", STRING));
+  ASSERT_TRUE(parse("A:STRING=b \t\r", "A", "b", STRING));
+  ASSERT_TRUE(parse("A:STRING=   ", "A", "   ", STRING));
+  ASSERT_TRUE(parse("A:STRING= \t", "A", " \t", STRING));
+  ASSERT_TRUE(parse("A:STRING='b '", "A", "b ", STRING));
+  ASSERT_TRUE(parse("A:STRING='", "A", "'", STRING));
+  ASSERT_TRUE(parse("\"A:B\":STRING=c", "A:B", "c", STRING));
+  ASSERT_TRUE(parse("\"//A\":STRING=c", "//A", "c", STRING));
+  ASSERT_TRUE(parse("\"A:B=C\":STRING=d", "A:B=C", "d", STRING));
+  ASSERT_TRUE(parse("A=b", "A", "b", UNINITIALIZED));
+  ASSERT_TRUE(parse("A=b:c", "A", "b:c", UNINITIALIZED));
+  ASSERT_TRUE(parse("\"A=B\"=c", "A=B", "c", UNINITIALIZED));
+  ASSERT_TRUE(parse("A:=b", "A", "b", STRING));
+
+  // A quoted key without a following value falls back to a plain key.
+  ASSERT_TRUE(parse("\"a:b=c\":T", "\"a", "c\":T", STRING));
+  ASSERT_TRUE(parse("\"a=b\":T", "\"a", "b\":T", UNINITIALIZED));
+
+  std::string key;
+  std::string value;
+  cmStateEnums::CacheEntryType type = cmStateEnums::UNINITIALIZED;
+  ASSERT_TRUE(!cmState::ParseCacheEntry("", key, value, type));
+  ASSERT_TRUE(!cmState::ParseCacheEntry("A", key, value, type));
+  ASSERT_TRUE(!cmState::ParseCacheEntry("A:STRING", key, value, type));
+  return true;
+}
+
+long long msSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+           std::chrono::steady_clock::now() - start)
+    .count();
+}
+
+bool testLargeCache()
+{
+  std::cout << "testLargeCache()\n";
+
+  std::string const dir = "testCacheManager";
+  std::string const cacheFile = cmStrCat(dir, "/CMakeCache.txt");
+  cmSystemTools::RemoveADirectory(dir);
+  cmSystemTools::MakeDirectory(dir);
+
+  // A synthetic cache shaped like a project with many vendored options.
+  std::size_t const n = 50000;
+  {
+    cmsys::ofstream fout(cacheFile.c_str());
+    fout << "# This is the CMakeCache file.\n\n";
+    for (std::size_t i = 0; i < n; ++i) {
+      fout << "//Option " << i << " of a vendored dependency that\n"
+           << "//\\n spans two help lines.\n"
+           << "VENDOR_OPTION_" << i << ":STRING=value " << i << "\r\n\n";
+      if (i % 10 == 0) {
+        fout << "VENDOR_OPTION_" << i << "-ADVANCED:INTERNAL=1\n";
+      }
+    }
+  }
+
+  cmCacheManager manager;
+  std::set<std::string> excludes;
+  std::set<std::string> includes;
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(manager.LoadCache(dir, true, excludes, includes));
+  std::cout << "  load " << n << " entries in " << msSince(start) << " ms\n";
+
+  cmValue const value = manager.GetCacheEntryValue("VENDOR_OPTION_4242");
+  ASSERT_TRUE(value && *value == "value 4242");
+  cmValue const help =
+    manager.GetCacheEntryProperty("VENDOR_OPTION_4242", "HELPSTRING");
+  ASSERT_TRUE(help &&
+              *help ==
+                "Option 4242 of a vendored dependency that\n"
+                " spans two help lines.");
+  ASSERT_TRUE(
+    manager.GetCacheEntryPropertyAsBool("VENDOR_OPTION_4240", "ADVANCED"));
+
+  start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(manager.SaveCache(dir, nullptr));
+  std::cout << "  save in " << msSince(start) << " ms\n";
+
+  // Saving an unchanged cache trusts the file times of the last save and
+  // does not even compare the content.  Edit the file behind its back,
+  // keeping its size and times, to see that it is not written again.
+  std::string text;
+  {
+    cmsys::ifstream fin(cacheFile.c_str(), std::ios::in | std::ios::binary);
+    text.assign(std::istreambuf_iterator<char>(fin),
+                std::istreambuf_iterator<char>());
+  }
+  ASSERT_TRUE(cmHasLiteralPrefix(text, "# This is the CMakeCache file."));
+  {
+    // Restoring the times may drop their sub-second part, so let the
+    // cache see the times as they will be restored.
+    cmFileTimes const times(cacheFile);
+    ASSERT_TRUE(times.Store(cacheFile));
+    ASSERT_TRUE(manager.SaveCache(dir, nullptr));
+    text[0] = '!';
+    {
+      cmsys::ofstream fout(cacheFile.c_str(),
+                           std::ios::out | std::ios::binary);
+      fout << text;
+    }
+    ASSERT_TRUE(times.Store(cacheFile));
+  }
+  start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(manager.SaveCache(dir, nullptr));
+  std::cout << "  unchanged save in " << msSince(start) << " ms\n";
+  {
+    cmsys::ifstream fin(cacheFile.c_str());
+    std::string line;
+    ASSERT_TRUE(std::getline(fin, line) &&
+                line == "! This is the CMakeCache file.");
+  }
+
+  // A modified entry is written out and read back.
+  manager.AddCacheEntry("VENDOR_OPTION_7", "changed", "Changed option",
+                        cmStateEnums::STRING);
+  ASSERT_TRUE(manager.SaveCache(dir, nullptr));
+  cmCacheManager reloaded;
+  ASSERT_TRUE(reloaded.LoadCache(dir, true, excludes, includes));
+  ASSERT_TRUE(reloaded.GetCacheEntryKeys().size() ==
+              manager.GetCacheEntryKeys().size());
+  ASSERT_TRUE(*reloaded.GetCacheEntryValue("VENDOR_OPTION_7") == "changed");
+  ASSERT_TRUE(*reloaded.GetCacheEntryValue("VENDOR_OPTION_49999") ==
+              "value 49999");
+
+  cmSystemTools::RemoveADirectory(dir);
+  return true;
+}
+}
+
+int testCacheManager(int /*unused*/, char* /*unused*/[])
+{
+  return runTests({
+    testParseCacheEntry,
+    testLargeCache,
+  });
+}
@@ -0,0 +1,115 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file Copyright.txt or https://cmake.org/licensing for details.  */
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "cmComputeComponentGraph.h"
+#include "cmGraphAdjacencyList.h"
+#include "cmListFileCache.h"
+
+#include "testCommon.h"
+
+namespace {
+
+using Graph = cmGraphAdjacencyList;
+
+void addEdge(Graph& graph, std::size_t from, std::size_t to)
+{
+  graph[from].emplace_back(to, true, false, cmListFileBacktrace());
+}
+
+bool testSmallGraph()
+{
+  std::cout << "testSmallGraph()\n";
+
+  // 0 -> 1 <-> 2 -> 3, 4 -> 3
+  Graph graph;
+  graph.resize(5);
+  addEdge(graph, 0, 1);
+  addEdge(graph, 1, 2);
+  addEdge(graph, 2, 1);
+  addEdge(graph, 2, 3);
+  addEdge(graph, 4, 3);
+
+  cmComputeComponentGraph ccg(graph);
+  ccg.Compute();
+
+  // Components are enumerated with dependencies first.
+  std::vector<cmGraphNodeList> const& components = ccg.GetComponents();
+  ASSERT_TRUE(components.size() == 4);
+  ASSERT_TRUE(components[0].size() == 1 && components[0][0] == 3);
+  ASSERT_TRUE(components[1].size() == 2 && components[1][0] == 1 &&
+              components[1][1] == 2);
+  ASSERT_TRUE(components[2].size() == 1 && components[2][0] == 0);
+  ASSERT_TRUE(components[3].size() == 1 && components[3][0] == 4);
+
+  std::vector<std::size_t> const& cmap = ccg.GetComponentMap();
+  ASSERT_TRUE(cmap[1] == cmap[2]);
+  ASSERT_TRUE(ccg.GetComponentGraphEdges(cmap[0]).size() == 1);
+  ASSERT_TRUE(ccg.GetComponentGraphEdges(cmap[2]).size() == 1);
+  ASSERT_TRUE(ccg.GetComponentGraphEdges(cmap[3]).empty());
+  return true;
+}
+
+bool testLargeGraph()
+{
+  std::cout << "testLargeGraph()\n";
+
+  // A synthetic graph shaped like the static libraries of a very large
+  // project: one long dependency chain in which every group of three
+  // libraries forms a cyclic link group, plus edges skipping ahead.
+  std::size_t const groups = 100000;
+  std::size_t const n = groups * 3;
+  Graph graph;
+  graph.resize(n);
+  for (std::size_t g = 0; g < groups; ++g) {
+    std::size_t const first = g * 3;
+    addEdge(graph, first, first + 1);
+    addEdge(graph, first + 1, first + 2);
+    addEdge(graph, first + 2, first);
+    if (g + 1 < groups) {
+      addEdge(graph, first + 2, first + 3);
+    }
+    if (g + 10 < groups) {
+      addEdge(graph, first, first + 30);
+    }
+  }
+
+  auto const start = std::chrono::steady_clock::now();
+  cmComputeComponentGraph ccg(graph);
+  ccg.Compute();
+  auto const stop = std::chrono::steady_clock::now();
+  std::cout << "  " << n << " nodes in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(stop -
+                                                                     start)
+                 .count()
+            << " ms\n";
+
+  std::vector<cmGraphNodeList> const& components = ccg.GetComponents();
+  ASSERT_TRUE(components.size() == groups);
+
+  // The last group is a dependency of all others, so it comes first.
+  ASSERT_TRUE(components.front().size() == 3 &&
+              components.front()[0] == n - 3);
+  ASSERT_TRUE(components.back().size() == 3 && components.back()[0] == 0);
+
+  std::vector<std::size_t> const& cmap = ccg.GetComponentMap();
+  for (std::size_t g = 0; g < groups; ++g) {
+    std::size_t const c = cmap[g * 3];
+    ASSERT_TRUE(cmap[g * 3 + 1] == c && cmap[g * 3 + 2] == c);
+    ASSERT_TRUE(c == groups - 1 - g);
+  }
+  return true;
+}
+}
+
+int testComputeComponentGraph(int /*unused*/, char* /*unused*/[])
+{
+  return runTests({
+    testSmallGraph,
+    testLargeGraph,
+  });
+}
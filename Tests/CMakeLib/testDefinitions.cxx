@@ -0,0 +1,239 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file Copyright.txt or https://cmake.org/licensing for details.  */
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cmDefinitions.h"
+#include "cmLinkedTree.h"
+#include "cmValue.h"
+
+#include "testCommon.h"
+
+namespace {
+
+using StackIter = cmLinkedTree<cmDefinitions>::iterator;
+
+// Number of nested scopes, similar to a deep function() call chain.
+std::size_t const Depth = 256;
+
+StackIter pushScopes(cmLinkedTree<cmDefinitions>& tree, StackIter bottom,
+                     std::size_t depth)
+{
+  StackIter top = bottom;
+  for (std::size_t i = 0; i < depth; ++i) {
+    top = tree.Push(top);
+  }
+  return top;
+}
+
+bool testGetDeep()
+{
+  std::cout << "testGetDeep()\n";
+  cmLinkedTree<cmDefinitions> tree;
+  StackIter root = tree.Root();
+  StackIter bottom = tree.Push(root);
+  bottom->Set("A", "a");
+  StackIter top = pushScopes(tree, bottom, Depth);
+
+  // Repeated reads return the definition from the bottom scope.
+  for (int i = 0; i < 1000; ++i) {
+    cmValue a = cmDefinitions::Get("A", top, root);
+    ASSERT_TRUE(a && *a == "a");
+  }
+  ASSERT_TRUE(!cmDefinitions::Get("B", top, root));
+
+  // A local definition shadows the parents.
+  top->Set("A", "top");
+  ASSERT_TRUE(*cmDefinitions::Get("A", top, root) == "top");
+  top->Unset("A");
+  ASSERT_TRUE(!cmDefinitions::Get("A", top, root));
+  return true;
+}
+
+long long msSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+           std::chrono::steady_clock::now() - start)
+    .count();
+}
+
+bool testGetDeepLarge()
+{
+  std::cout << "testGetDeepLarge()\n";
+  cmLinkedTree<cmDefinitions> tree;
+  StackIter root = tree.Root();
+  StackIter bottom = tree.Push(root);
+
+  // Mimic a deep call chain reading variables of the top-level directory,
+  // such as compiler settings, on every command.
+  std::size_t const depth = 1000;
+  std::size_t const vars = 200;
+  std::size_t const reads = 1000;
+  std::vector<std::string> names;
+  for (std::size_t v = 0; v < vars; ++v) {
+    names.push_back("CMAKE_VARIABLE_" + std::to_string(v));
+    bottom->Set(names.back(), "value");
+  }
+  StackIter top = pushScopes(tree, bottom, depth);
+
+  auto start = std::chrono::steady_clock::now();
+  for (std::string const& name : names) {
+    ASSERT_TRUE(cmDefinitions::Get(name, top, root));
+  }
+  std::cout << "  " << vars << " first reads through " << depth
+            << " scopes in " << msSince(start) << " ms\n";
+
+  start = std::chrono::steady_clock::now();
+  for (std::size_t r = 0; r < reads; ++r) {
+    for (std::string const& name : names) {
+      ASSERT_TRUE(cmDefinitions::Get(name, top, root));
+    }
+  }
+  std::cout << "  " << reads * vars << " repeated reads in " << msSince(start)
+            << " ms\n";
+  return true;
+}
+
+bool testGetAfterPop()
+{
+  std::cout << "testGetAfterPop()\n";
+  cmLinkedTree<cmDefinitions> tree;
+  StackIter root = tree.Root();
+  StackIter bottom = tree.Push(root);
+  bottom->Set("A", "a");
+
+  // Reads from one call chain do not leak into a later one.
+  std::vector<StackIter> scopes;
+  scopes.push_back(bottom);
+  for (std::size_t i = 0; i < Depth; ++i) {
+    scopes.push_back(tree.Push(scopes.back()));
+  }
+  ASSERT_TRUE(*cmDefinitions::Get("A", scopes.back(), root) == "a");
+  while (scopes.size() > 1) {
+    tree.Pop(scopes.back());
+    scopes.pop_back();
+  }
+  bottom->Set("A", "b");
+  StackIter top = pushScopes(tree, bottom, Depth);
+  ASSERT_TRUE(*cmDefinitions::Get("A", top, root) == "b");
+  return true;
+}
+
+bool testRaise()
+{
+  std::cout << "testRaise()\n";
+  cmLinkedTree<cmDefinitions> tree;
+  StackIter root = tree.Root();
+  StackIter bottom = tree.Push(root);
+  bottom->Set("A", "a");
+  StackIter parent = pushScopes(tree, bottom, Depth);
+  StackIter top = tree.Push(parent);
+
+  // Mimic set(A ... PARENT_SCOPE) after the value has been read.
+  ASSERT_TRUE(*cmDefinitions::Get("A", top, root) == "a");
+  cmDefinitions::Raise("A", top, root);
+  parent->Set("A", "p");
+  ASSERT_TRUE(*cmDefinitions::Get("A", top, root) == "a");
+  ASSERT_TRUE(*cmDefinitions::Get("A", parent, root) == "p");
+  ASSERT_TRUE(*cmDefinitions::Get("A", bottom, root) == "a");
+
+  // Mimic set(B ... PARENT_SCOPE) before the value has been read.
+  cmDefinitions::Raise("B", top, root);
+  parent->Set("B", "p");
+  ASSERT_TRUE(!cmDefinitions::Get("B", top, root));
+  ASSERT_TRUE(*cmDefinitions::Get("B", parent, root) == "p");
+  return true;
+}
+
+bool testHasKey()
+{
+  std::cout << "testHasKey()\n";
+  cmLinkedTree<cmDefinitions> tree;
+  StackIter root = tree.Root();
+  StackIter bottom = tree.Push(root);
+  bottom->Set("A", "a");
+  bottom->Unset("U");
+  StackIter top = pushScopes(tree, bottom, Depth);
+
+  // Reading an undefined variable does not initialize it.
+  ASSERT_TRUE(!cmDefinitions::Get("B", top, root));
+  ASSERT_TRUE(!cmDefinitions::HasKey("B", top, root));
+  ASSERT_TRUE(!cmDefinitions::Get("U", top, root));
+  ASSERT_TRUE(cmDefinitions::HasKey("U", top, root));
+  ASSERT_TRUE(cmDefinitions::Get("A", top, root));
+  ASSERT_TRUE(cmDefinitions::HasKey("A", top, root));
+
+  std::vector<std::string> keys = cmDefinitions::ClosureKeys(top, root);
+  ASSERT_TRUE(keys.size() == 1 && keys[0] == "A");
+  return true;
+}
+
+bool testAppend()
+{
+  std::cout << "testAppend()\n";
+  cmLinkedTree<cmDefinitions> tree;
+  StackIter root = tree.Root();
+  StackIter bottom = tree.Push(root);
+  bottom->Set("A", "a");
+  bottom->Unset("U");
+  StackIter top = pushScopes(tree, bottom, Depth);
+
+  // Appending to a parent definition changes only the current scope.
+  ASSERT_TRUE(cmDefinitions::Append("A", ";b", top, root));
+  ASSERT_TRUE(*cmDefinitions::Get("A", top, root) == "a;b");
+  ASSERT_TRUE(*cmDefinitions::Get("A", bottom, root) == "a");
+  ASSERT_TRUE(cmDefinitions::Append("A", ";c", bottom, root));
+  ASSERT_TRUE(*cmDefinitions::Get("A", top, root) == "a;b");
+  ASSERT_TRUE(*cmDefinitions::Get("A", bottom, root) == "a;c");
+
+  // There is nothing to append to without a definition.
+  ASSERT_TRUE(!cmDefinitions::Append("U", "u", top, root));
+  ASSERT_TRUE(!cmDefinitions::Append("B", "b", top, root));
+  ASSERT_TRUE(!cmDefinitions::Get("B", top, root));
+  return true;
+}
+
+bool testAppendLarge()
+{
+  std::cout << "testAppendLarge()\n";
+  cmLinkedTree<cmDefinitions> tree;
+  StackIter root = tree.Root();
+  StackIter scope = tree.Push(root);
+
+  // Mimic list(APPEND) of a long source list, one file at a time.
+  std::size_t const n = 50000;
+  std::string const item = ";src/generated/file_with_a_long_name.cxx";
+  scope->Set("SRCS", "main.cxx");
+  auto const start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_TRUE(cmDefinitions::Append("SRCS", item, scope, root));
+  }
+  auto const stop = std::chrono::steady_clock::now();
+  std::cout << "  " << n << " appends in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(stop -
+                                                                     start)
+                 .count()
+            << " ms\n";
+
+  cmValue srcs = cmDefinitions::Get("SRCS", scope, root);
+  ASSERT_TRUE(srcs && srcs->size() == 8 + n * item.size());
+  return true;
+}
+}
+
+int testDefinitions(int /*unused*/, char* /*unused*/[])
+{
+  return runTests({
+    testGetDeep,
+    testGetDeepLarge,
+    testGetAfterPop,
+    testRaise,
+    testHasKey,
+    testAppend,
+    testAppendLarge,
+  });
+}
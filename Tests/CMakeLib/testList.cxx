@@ -1,6 +1,8 @@
 /* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
    file Copyright.txt or https://cmake.org/licensing for details.  */
 
+#include <chrono>
+#include <cstddef>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -947,6 +949,109 @@ bool testStaticModifiers()
 
   return result;
 }
+
+bool testView()
+{
+  std::cout << "testView()";
+
+  bool result = true;
+
+  struct Case
+  {
+    std::string Value;
+    cmList::EmptyElements Empty;
+    std::vector<std::string> Elements;
+  };
+  auto const No = cmList::EmptyElements::No;
+  auto const Yes = cmList::EmptyElements::Yes;
+  std::vector<Case> const cases{
+    { "", No, {} },
+    { "", Yes, { "" } },
+    { ";", No, {} },
+    { ";", Yes, { "", "" } },
+    { "a", No, { "a" } },
+    { "a;b;c", No, { "a", "b", "c" } },
+    { ";a;;b;", No, { "a", "b" } },
+    { ";a;;b;", Yes, { "", "a", "", "b", "" } },
+    { "a\\;b;c", No, { "a;b", "c" } },
+    { "\\;", No, { ";" } },
+    { "a\\;;b\\;", Yes, { "a;", "b;" } },
+    { "a\\b;c\\", No, { "a\\b", "c\\" } },
+    { "[a;b];c", No, { "[a;b]", "c" } },
+    { "[[;]];x", No, { "[[;]]", "x" } },
+    { "a];b;[c", No, { "a];b;[c" } },
+  };
+  for (auto const& c : cases) {
+    cmListView const view{ c.Value, c.Empty };
+    std::vector<std::string> elements;
+    for (cm::string_view element : view) {
+      elements.emplace_back(element);
+    }
+    cmList const list{ c.Value, c.Empty };
+    if (elements != c.Elements || list.data() != c.Elements ||
+        view.size() != c.Elements.size() ||
+        view.empty() != c.Elements.empty()) {
+      std::cout << "\n  unexpected elements for \"" << c.Value << '"';
+      result = false;
+    }
+  }
+
+  {
+    cmListView const view{ cmValue(nullptr), cmList::EmptyElements::Yes };
+    if (!view.empty()) {
+      result = false;
+    }
+  }
+
+  checkResult(result);
+
+  return result;
+}
+
+long long msSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+           std::chrono::steady_clock::now() - start)
+    .count();
+}
+
+bool testViewLarge()
+{
+  std::cout << "testViewLarge()\n";
+
+  // A list shaped like the sources of a large target.
+  std::size_t const n = 200000;
+  std::string value;
+  for (std::size_t i = 0; i < n; ++i) {
+    value += "src/module/generated/file_with_a_long_name_";
+    value += std::to_string(i);
+    value += ".cxx;";
+  }
+  int const rounds = 10;
+
+  auto start = std::chrono::steady_clock::now();
+  std::size_t total = 0;
+  for (int r = 0; r < rounds; ++r) {
+    cmList const list{ value };
+    for (auto const& element : list) {
+      total += element.size();
+    }
+  }
+  std::cout << "  cmList: " << msSince(start) << " ms\n";
+
+  start = std::chrono::steady_clock::now();
+  std::size_t viewTotal = 0;
+  for (int r = 0; r < rounds; ++r) {
+    for (cm::string_view element : cmListView{ value }) {
+      viewTotal += element.size();
+    }
+  }
+  std::cout << "  cmListView: " << msSince(start) << " ms\n";
+
+  bool const result = total == viewTotal && cmListView{ value }.size() == n;
+  checkResult(result);
+  return result;
+}
 }
 
 int testList(int /*unused*/, char* /*unused*/[])
@@ -989,6 +1094,12 @@ int testList(int /*unused*/, char* /*unused*/[])
   if (!testStaticModifiers()) {
     result = 1;
   }
+  if (!testView()) {
+    result = 1;
+  }
+  if (!testViewLarge()) {
+    result = 1;
+  }
 
   return result;
 }
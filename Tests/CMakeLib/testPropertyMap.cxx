@@ -0,0 +1,204 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file Copyright.txt or https://cmake.org/licensing for details.  */
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cmInternedString.h"
+#include "cmPropertyMap.h"
+#include "cmValue.h"
+
+#include "testCommon.h"
+
+namespace {
+
+bool testSetGet()
+{
+  std::cout << "testSetGet()\n";
+  cmPropertyMap map;
+  ASSERT_TRUE(!map.GetPropertyValue("A"));
+
+  map.SetProperty("B", "b");
+  map.SetProperty("A", "a");
+  map.SetProperty("C", "");
+  ASSERT_TRUE(*map.GetPropertyValue("A") == "a");
+  ASSERT_TRUE(*map.GetPropertyValue("B") == "b");
+  ASSERT_TRUE(map.GetPropertyValue("C"));
+  ASSERT_TRUE(map.GetPropertyValue("C")->empty());
+  ASSERT_TRUE(!map.GetPropertyValue("D"));
+
+  // Setting a null value removes the property.
+  map.SetProperty("B", cmValue(nullptr));
+  ASSERT_TRUE(!map.GetPropertyValue("B"));
+  map.RemoveProperty("C");
+  ASSERT_TRUE(!map.GetPropertyValue("C"));
+  ASSERT_TRUE(*map.GetPropertyValue("A") == "a");
+
+  map.Clear();
+  ASSERT_TRUE(!map.GetPropertyValue("A"));
+  ASSERT_TRUE(map.GetKeys().empty());
+  return true;
+}
+
+bool testAppend()
+{
+  std::cout << "testAppend()\n";
+  cmPropertyMap map;
+  map.AppendProperty("L", "a");
+  map.AppendProperty("L", "");
+  map.AppendProperty("L", "b");
+  map.AppendProperty("L", "c", true);
+  ASSERT_TRUE(*map.GetPropertyValue("L") == "a;bc");
+
+  // Nothing is created to append nothing to.
+  map.AppendProperty("E", "");
+  ASSERT_TRUE(!map.GetPropertyValue("E"));
+  return true;
+}
+
+bool testCopy()
+{
+  std::cout << "testCopy()\n";
+  cmPropertyMap map;
+  map.SetProperty("A", "a");
+  map.AppendProperty("L", "x");
+
+  // Copies share values until either side modifies them.
+  cmPropertyMap copy = map;
+  ASSERT_TRUE(map.GetPropertyValue("A").Get() ==
+              copy.GetPropertyValue("A").Get());
+  copy.AppendProperty("L", "y");
+  map.SetProperty("A", "b");
+  ASSERT_TRUE(*map.GetPropertyValue("L") == "x");
+  ASSERT_TRUE(*copy.GetPropertyValue("L") == "x;y");
+  ASSERT_TRUE(*map.GetPropertyValue("A") == "b");
+  ASSERT_TRUE(*copy.GetPropertyValue("A") == "a");
+
+  // Independent maps share well-known values, but not any other value.
+  cmPropertyMap other;
+  other.SetProperty("A", "a");
+  ASSERT_TRUE(other.GetPropertyValue("A").Get() !=
+              copy.GetPropertyValue("A").Get());
+  other.SetProperty("B", "ON");
+  map.SetProperty("B", "ON");
+  ASSERT_TRUE(other.GetPropertyValue("B").Get() ==
+              map.GetPropertyValue("B").Get());
+
+  // Appending to a shared value does not modify it for the other maps.
+  other.AppendProperty("B", "x");
+  ASSERT_TRUE(*other.GetPropertyValue("B") == "ON;x");
+  ASSERT_TRUE(*map.GetPropertyValue("B") == "ON");
+  return true;
+}
+
+bool testLists()
+{
+  std::cout << "testLists()\n";
+  cmPropertyMap map;
+  map.SetProperty("Z", "z");
+  map.SetProperty("A", "a");
+  map.SetProperty("M", "m");
+
+  std::vector<std::string> keys = map.GetKeys();
+  ASSERT_TRUE((keys == std::vector<std::string>{ "A", "M", "Z" }));
+
+  std::vector<std::pair<std::string, std::string>> list = map.GetList();
+  ASSERT_TRUE(list.size() == 3);
+  ASSERT_TRUE(list[0].first == "A" && list[0].second == "a");
+  ASSERT_TRUE(list[2].first == "Z" && list[2].second == "z");
+  return true;
+}
+
+bool testInternedKeys()
+{
+  std::cout << "testInternedKeys()\n";
+  cmInternedString a("COMPILE_DEFINITIONS");
+  cmInternedString b(std::string("COMPILE_") + "DEFINITIONS");
+  ASSERT_TRUE(a == b);
+  ASSERT_TRUE(&a.str() == &b.str());
+  ASSERT_TRUE(a.str() == "COMPILE_DEFINITIONS");
+  ASSERT_TRUE(cmInternedString("COMPILE_OPTIONS") != a);
+  ASSERT_TRUE(a < cmInternedString("COMPILE_OPTIONS"));
+  ASSERT_TRUE(cmInternedString().empty());
+  ASSERT_TRUE(cmInternedString() == cmInternedString(""));
+
+  cmPropertyMap map;
+  map.SetProperty(b, "1");
+  ASSERT_TRUE(*map.GetPropertyValue(a) == "1");
+  return true;
+}
+
+bool testManyMaps()
+{
+  std::cout << "testManyMaps()\n";
+
+  // Mimic the source file properties of a large project: a unique
+  // LOCATION and short flag values on each source file.
+  std::size_t const n = 40000;
+  std::vector<std::pair<std::string, std::string>> const flags = {
+    { "COMPILE_DEFINITIONS", "A=1" },
+    { "COMPILE_OPTIONS", "-O2" },
+    { "GENERATED", "OFF" },
+    { "HEADER_FILE_ONLY", "OFF" },
+    { "INCLUDE_DIRECTORIES", "inc" },
+    { "LANGUAGE", "CXX" },
+    { "OBJECT_DEPENDS", "dep.h" },
+    { "SKIP_AUTOGEN", "ON" },
+    { "SKIP_PRECOMPILE_HEADERS", "ON" },
+    { "SKIP_UNITY_BUILD_INCLUSION", "OFF" },
+    { "SYMBOLIC", "FALSE" },
+  };
+  auto const start = std::chrono::steady_clock::now();
+  std::vector<cmPropertyMap> maps(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    maps[i].SetProperty("LOCATION",
+                        "/path/to/project/src/file" + std::to_string(i) +
+                          ".cxx");
+    for (auto const& flag : flags) {
+      maps[i].SetProperty(flag.first, flag.second);
+    }
+  }
+  std::size_t found = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (*maps[i].GetPropertyValue("LOCATION") ==
+        "/path/to/project/src/file" + std::to_string(i) + ".cxx") {
+      ++found;
+    }
+    for (auto const& flag : flags) {
+      if (*maps[i].GetPropertyValue(flag.first) == flag.second) {
+        ++found;
+      }
+    }
+  }
+  auto const stop = std::chrono::steady_clock::now();
+  std::cout << "  " << n * (flags.size() + 1) << " properties in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(stop -
+                                                                     start)
+                 .count()
+            << " ms\n";
+  ASSERT_TRUE(found == n * (flags.size() + 1));
+
+  // The well-known flag values are shared by all source files.
+  ASSERT_TRUE(maps.front().GetPropertyValue("LANGUAGE").Get() ==
+              maps.back().GetPropertyValue("LANGUAGE").Get());
+  ASSERT_TRUE(maps.front().GetPropertyValue("SKIP_AUTOGEN").Get() ==
+              maps.back().GetPropertyValue("SKIP_AUTOGEN").Get());
+  return true;
+}
+}
+
+int testPropertyMap(int /*unused*/, char* /*unused*/[])
+{
+  return runTests({
+    testSetGet,
+    testAppend,
+    testCopy,
+    testLists,
+    testInternedKeys,
+    testManyMaps,
+  });
+}
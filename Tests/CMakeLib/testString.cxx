@@ -412,6 +412,35 @@ static bool testOperatorPlusEqual()
   return true;
 }
 
+static bool testOperatorPlusEqualShared()
+{
+  std::cout << "testOperatorPlusEqualShared()\n";
+  cm::String str = std::string("a");
+  cm::String const copy = str;
+  str += "b";
+  ASSERT_TRUE(str == "ab");
+  ASSERT_TRUE(copy == "a");
+
+  // Copies keep their value while the original is extended in place.
+  cm::String const copy2 = str;
+  for (char c = 'c'; c <= 'z'; ++c) {
+    str += c;
+    str.push_back('.');
+  }
+  ASSERT_TRUE(str.size() == 50);
+  ASSERT_TRUE(str.substr(0, 7) == "abc.d.e");
+  ASSERT_TRUE(str.is_stable());
+  ASSERT_TRUE(copy == "a");
+  ASSERT_TRUE(copy2 == "ab");
+
+  // A view of part of a string is not extended in place.
+  cm::String part = str.substr(0, 2);
+  part += "!";
+  ASSERT_TRUE(part == "ab!");
+  ASSERT_TRUE(str.substr(0, 3) == "abc");
+  return true;
+}
+
 static bool testOperatorCompare()
 {
   std::cout << "testOperatorCompare()\n";
@@ -1250,6 +1279,9 @@ int testString(int /*unused*/, char* /*unused*/[])
   if (!testOperatorPlusEqual()) {
     return 1;
   }
+  if (!testOperatorPlusEqualShared()) {
+    return 1;
+  }
   if (!testOperatorCompare()) {
     return 1;
   }
@@ -0,0 +1,12 @@
+file(READ ${ProfilingTestOutput} profile)
+if (NOT profile MATCHES "\"args\"[ ]*:[ \t\r\n]*{([^}]*)}[ \t\r\n]*,[ \t\r\n]*\"name\"[ ]*:[ ]*\"condition_cache\"")
+  set(RunCMake_TEST_FAILED "Expected a condition_cache counter")
+  return()
+endif()
+set(counters "${CMAKE_MATCH_1}")
+if (NOT counters MATCHES "\"hits\"[ ]*:[ ]*[1-9]")
+  set(RunCMake_TEST_FAILED "Expected condition_cache hits")
+elseif(NOT counters MATCHES "\"misses\"[ ]*:[ ]*([0-9]+)" OR CMAKE_MATCH_1 LESS 3)
+  # The loop over v and the binary and logical shapes of 1 ${op} ${v}.
+  set(RunCMake_TEST_FAILED "Expected at least 3 condition_cache misses")
+endif()
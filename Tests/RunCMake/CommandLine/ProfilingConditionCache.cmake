@@ -0,0 +1,24 @@
+cmake_policy(SET CMP0139 NEW)
+# Every iteration after the first reuses the compiled condition.
+foreach(v IN ITEMS 1 2 3 4)
+  if(v GREATER 2 AND NOT (v EQUAL 4))
+    set(found ${v})
+  endif()
+endforeach()
+if(NOT found EQUAL 3)
+  message(FATAL_ERROR "Unexpected condition result \"${found}\"")
+endif()
+
+# An unquoted reference that expands to another keyword changes the shape
+# of the condition, so the compiled order of the old shape is not reused.
+set(results "")
+foreach(op IN ITEMS EQUAL LESS AND)
+  foreach(v IN ITEMS 1 2)
+    if(1 ${op} ${v})
+      list(APPEND results "${op}${v}")
+    endif()
+  endforeach()
+endforeach()
+if(NOT results STREQUAL "EQUAL1;LESS2;AND1;AND2")
+  message(FATAL_ERROR "Unexpected condition results \"${results}\"")
+endif()
@@ -0,0 +1,16 @@
+file(READ ${ProfilingTestOutput} profile)
+if (NOT profile MATCHES "\"args\"[ ]*:[ \t\r\n]*{([^}]*)}[ \t\r\n]*,[ \t\r\n]*\"name\"[ ]*:[ ]*\"genex_memo\"")
+  set(RunCMake_TEST_FAILED "Expected a genex_memo counter")
+  return()
+endif()
+if (NOT CMAKE_MATCH_1 MATCHES "\"hits\"[ ]*:[ ]*[1-9]")
+  set(RunCMake_TEST_FAILED "Expected genex_memo hits")
+  return()
+endif()
+foreach(t IN ITEMS memo_a memo_b)
+  file(READ ${RunCMake_TEST_BINARY_DIR}/${t}.txt content)
+  if(NOT content STREQUAL "memo-${t}\n")
+    set(RunCMake_TEST_FAILED "Unexpected content of ${t}.txt:\n ${content}")
+    return()
+  endif()
+endforeach()
@@ -0,0 +1,12 @@
+# Both evaluations share one parse tree, so the second is memoized.
+file(GENERATE OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/memo1.txt CONTENT "$<$<BOOL:ON>:memo>\n")
+file(GENERATE OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/memo2.txt CONTENT "$<$<BOOL:ON>:memo>\n")
+
+# An expression that reads a target property is not memoized, so each
+# target gets its own value from the shared parse tree.
+foreach(t IN ITEMS memo_a memo_b)
+  add_custom_target(${t})
+  set_property(TARGET ${t} PROPERTY MEMO_VALUE ${t})
+  file(GENERATE OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/${t}.txt
+    CONTENT "$<$<BOOL:ON>:memo>-$<TARGET_PROPERTY:MEMO_VALUE>\n" TARGET ${t})
+endforeach()
@@ -0,0 +1,12 @@
+file(READ ${ProfilingTestOutput} profile)
+if (NOT profile MATCHES "\"args\"[ ]*:[ \t\r\n]*{([^}]*)}[ \t\r\n]*,[ \t\r\n]*\"name\"[ ]*:[ ]*\"regex_cache\"")
+  set(RunCMake_TEST_FAILED "Expected a regex_cache counter")
+  return()
+endif()
+set(counters "${CMAKE_MATCH_1}")
+if (NOT counters MATCHES "\"hits\"[ ]*:[ ]*[1-9]")
+  set(RunCMake_TEST_FAILED "Expected regex_cache hits")
+elseif(NOT counters MATCHES "\"misses\"[ ]*:[ ]*([0-9]+)" OR CMAKE_MATCH_1 LESS 4104)
+  # Each of the 4104 patterns in the test misses at least once.
+  set(RunCMake_TEST_FAILED "Expected at least 4104 regex_cache misses")
+endif()
@@ -0,0 +1,30 @@
+# Every call after the first reuses the compiled pattern.
+foreach(v IN ITEMS 1.2.3 4.5.6 7.8.9)
+  string(REGEX MATCH "^([0-9]+)\\.([0-9]+)" m "${v}")
+  if(NOT m MATCHES "^[0-9]+\\.[0-9]+$")
+    message(FATAL_ERROR "Unexpected match \"${m}\" for \"${v}\"")
+  endif()
+  string(REGEX REPLACE "^([0-9]+)\\.([0-9]+)" "\\2.\\1" r "${v}")
+endforeach()
+if(NOT r STREQUAL "8.7.9" OR NOT CMAKE_MATCH_1 STREQUAL "7")
+  message(FATAL_ERROR "Unexpected replacement \"${r}\"")
+endif()
+
+# A different pattern on the same subject is compiled on its own and does
+# not leave the groups of the cached one behind.
+string(REGEX MATCH "^([0-9]+)" m "7.8.9")
+if(NOT m STREQUAL "7" OR NOT CMAKE_MATCH_COUNT EQUAL 1 OR NOT CMAKE_MATCH_2 STREQUAL "")
+  message(FATAL_ERROR "Unexpected match \"${m}\" for a changed pattern")
+endif()
+
+# Fill the cache until it starts over, then use the first pattern again.
+foreach(i RANGE 4100)
+  string(REGEX MATCH "^x${i}$" m "x${i}")
+  if(NOT m STREQUAL "x${i}")
+    message(FATAL_ERROR "Unexpected match \"${m}\" for \"x${i}\"")
+  endif()
+endforeach()
+string(REGEX REPLACE "^([0-9]+)\\.([0-9]+)" "\\2.\\1" r "1.2.3")
+if(NOT r STREQUAL "2.1.3")
+  message(FATAL_ERROR "Unexpected replacement \"${r}\" after the cache was reset")
+endif()
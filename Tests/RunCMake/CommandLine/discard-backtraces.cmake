@@ -0,0 +1,7 @@
+enable_language(C)
+
+set(CMAKE_DEBUG_TARGET_PROPERTIES INCLUDE_DIRECTORIES)
+
+file(WRITE "${CMAKE_CURRENT_BINARY_DIR}/empty.c" "")
+add_library(discard STATIC "${CMAKE_CURRENT_BINARY_DIR}/empty.c")
+target_include_directories(discard PRIVATE "${CMAKE_CURRENT_SOURCE_DIR}/include")
@@ -0,0 +1,17 @@
+# The interfaces of a, b and c form a cycle.
+set(CMAKE_DEBUG_TARGET_PROPERTIES CLOSURE_PROP)
+foreach(t IN ITEMS a b c d)
+  add_library(${t} INTERFACE)
+  set_property(TARGET ${t} PROPERTY INTERFACE_CLOSURE_PROP x)
+endforeach()
+set_property(TARGET d PROPERTY COMPATIBLE_INTERFACE_STRING CLOSURE_PROP)
+set_property(TARGET a PROPERTY INTERFACE_LINK_LIBRARIES b)
+set_property(TARGET b PROPERTY INTERFACE_LINK_LIBRARIES c d)
+set_property(TARGET c PROPERTY INTERFACE_LINK_LIBRARIES a)
+
+add_executable(head1 main.cpp)
+target_link_libraries(head1 a)
+add_executable(head2 main.cpp)
+target_link_libraries(head2 c)
+add_executable(head3 main.cpp)
+target_link_libraries(head3 b)
@@ -0,0 +1,17 @@
+# Every node of the graph sets the same value, so the compatibility report
+# lists the link closure of each head in order.
+set(CMAKE_DEBUG_TARGET_PROPERTIES CLOSURE_PROP)
+foreach(t IN ITEMS top left right bottom leaf)
+  add_library(${t} INTERFACE)
+  set_property(TARGET ${t} PROPERTY INTERFACE_CLOSURE_PROP x)
+endforeach()
+set_property(TARGET leaf PROPERTY COMPATIBLE_INTERFACE_STRING CLOSURE_PROP)
+set_property(TARGET top PROPERTY INTERFACE_LINK_LIBRARIES left right)
+set_property(TARGET left PROPERTY INTERFACE_LINK_LIBRARIES bottom)
+set_property(TARGET right PROPERTY INTERFACE_LINK_LIBRARIES bottom)
+set_property(TARGET bottom PROPERTY INTERFACE_LINK_LIBRARIES leaf)
+
+add_executable(head1 main.cpp)
+target_link_libraries(head1 top right)
+add_executable(head2 main.cpp)
+target_link_libraries(head2 right left top)
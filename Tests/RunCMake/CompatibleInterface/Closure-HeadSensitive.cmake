@@ -0,0 +1,17 @@
+# The interface of sel depends on the head target, so the closure of the
+# common target that links to it must not be shared by the two heads.
+set(CMAKE_DEBUG_TARGET_PROPERTIES CLOSURE_PROP)
+foreach(t IN ITEMS common sel a b)
+  add_library(${t} INTERFACE)
+  set_property(TARGET ${t} PROPERTY INTERFACE_CLOSURE_PROP x)
+endforeach()
+set_property(TARGET common PROPERTY COMPATIBLE_INTERFACE_STRING CLOSURE_PROP)
+set_property(TARGET common PROPERTY INTERFACE_LINK_LIBRARIES sel)
+set_property(TARGET sel PROPERTY INTERFACE_LINK_LIBRARIES
+  "$<IF:$<BOOL:$<TARGET_PROPERTY:USE_A>>,a,b>")
+
+add_executable(head1 main.cpp)
+set_property(TARGET head1 PROPERTY USE_A 1)
+target_link_libraries(head1 common)
+add_executable(head2 main.cpp)
+target_link_libraries(head2 common)
@@ -0,0 +1,4 @@
+file(READ "${RunCMake_TEST_BINARY_DIR}/closure.txt" closure)
+if(NOT closure STREQUAL "deep\n")
+  set(RunCMake_TEST_FAILED "Expected the value of the end of the chain, got:\n${closure}")
+endif()
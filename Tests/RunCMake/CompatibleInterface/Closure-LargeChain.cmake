@@ -0,0 +1,18 @@
+# Each library of a long chain links to the next one, and every link of
+# the chain has a consumer, so each closure is merged into the next one.
+set(n 300)
+foreach(i RANGE ${n})
+  add_library(chain${i} INTERFACE)
+  if(i GREATER 0)
+    math(EXPR prev "${i} - 1")
+    set_property(TARGET chain${prev} PROPERTY INTERFACE_LINK_LIBRARIES chain${i})
+    add_library(user${i} STATIC empty.cpp)
+    target_link_libraries(user${i} PRIVATE chain${prev})
+  endif()
+endforeach()
+set_property(TARGET chain${n} PROPERTY COMPATIBLE_INTERFACE_STRING CLOSURE_PROP)
+set_property(TARGET chain${n} PROPERTY INTERFACE_CLOSURE_PROP deep)
+
+add_executable(head main.cpp)
+target_link_libraries(head chain0)
+file(GENERATE OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/closure.txt CONTENT "$<TARGET_PROPERTY:head,CLOSURE_PROP>\n")
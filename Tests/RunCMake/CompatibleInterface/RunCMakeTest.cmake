@@ -12,6 +12,10 @@ run_cmake(InterfaceString-builtin-prop)
 run_cmake(InterfaceString-Bool-Conflict)
 run_cmake(InterfaceString-Bool-Min-Conflict)
 run_cmake(DebugProperties)
+run_cmake(Closure-Diamond)
+run_cmake(Closure-Cycle)
+run_cmake(Closure-HeadSensitive)
+run_cmake(Closure-LargeChain)
 
 if (QT_QMAKE_EXECUTABLE})
   set(RunCMake_TEST_OPTIONS -DQT_QMAKE_EXECUTABLE:FILEPATH=${QT_QMAKE_EXECUTABLE})
@@ -0,0 +1,10 @@
+set(expect hit)
+include(${CMAKE_CURRENT_LIST_DIR}/CheckCounter.cmake)
+if(RunCMake_TEST_FAILED)
+  return()
+endif()
+file(STRINGS "${RunCMake_TEST_BINARY_DIR}/CMakeCache.txt" compilerEntry
+  REGEX "^CMAKE_C_COMPILER:FILEPATH=")
+if(NOT compilerEntry)
+  set(RunCMake_TEST_FAILED "Expected a CMAKE_C_COMPILER cache entry")
+endif()
@@ -0,0 +1,2 @@
+set(expect miss)
+include(${CMAKE_CURRENT_LIST_DIR}/CheckCounter.cmake)
@@ -0,0 +1,2 @@
+set(expect hit)
+include(${CMAKE_CURRENT_LIST_DIR}/CheckCounter.cmake)
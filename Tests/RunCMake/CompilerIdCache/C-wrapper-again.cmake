@@ -0,0 +1 @@
+include(C.cmake)
@@ -0,0 +1,10 @@
+enable_language(C)
+
+if(NOT CMAKE_C_COMPILER_ID OR NOT CMAKE_C_COMPILER_WORKS)
+  message(FATAL_ERROR "C compiler information not loaded")
+endif()
+
+try_compile(result SOURCE_FROM_CONTENT main.c "int main(void) { return 0; }\n")
+if(NOT result)
+  message(FATAL_ERROR "try_compile with the C compiler failed")
+endif()
@@ -0,0 +1,29 @@
+# Check that the compiler_id_cache counter recorded one ${expect}.
+file(READ ${CompilerIdCacheProfile} profile)
+if(NOT profile MATCHES "\"args\"[ ]*:[ \t\r\n]*{([^}]*)}[ \t\r\n]*,[ \t\r\n]*\"name\"[ ]*:[ ]*\"compiler_id_cache\"")
+  set(RunCMake_TEST_FAILED "Expected a compiler_id_cache counter")
+  return()
+endif()
+set(cacheCounter "${CMAKE_MATCH_1}")
+if(expect STREQUAL "hit")
+  set(expectHits 1)
+  set(expectMisses 0)
+else()
+  set(expectHits 0)
+  set(expectMisses 1)
+endif()
+foreach(kind IN ITEMS hits misses)
+  set(count 0)
+  if(cacheCounter MATCHES "\"${kind}\"[ ]*:[ ]*([0-9]+)")
+    set(count "${CMAKE_MATCH_1}")
+  endif()
+  if(kind STREQUAL "hits")
+    set(expected ${expectHits})
+  else()
+    set(expected ${expectMisses})
+  endif()
+  if(NOT count EQUAL expected)
+    set(RunCMake_TEST_FAILED "Expected ${expected} compiler_id_cache ${kind}, not ${count}")
+    return()
+  endif()
+endforeach()
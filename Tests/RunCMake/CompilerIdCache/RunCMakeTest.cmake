@@ -0,0 +1,36 @@
+include(RunCMake)
+
+function(run_cached case)
+  set(CompilerIdCacheProfile "${RunCMake_BINARY_DIR}/${case}-profile.json")
+  list(APPEND RunCMake_TEST_OPTIONS --profiling-format=google-trace --profiling-output=${CompilerIdCacheProfile})
+  run_cmake(${case})
+endfunction()
+
+# A second build tree reuses the compiler information of the first one.
+set(ENV{CMAKE_COMPILER_ID_CACHE_DIR} "${RunCMake_BINARY_DIR}/cache")
+file(REMOVE_RECURSE "${RunCMake_BINARY_DIR}/cache")
+run_cmake(C)
+run_cached(C-again)
+
+# Changed flags select another entry.
+set(RunCMake_TEST_OPTIONS -DCMAKE_C_FLAGS=-DCOMPILER_ID_CACHE_FLAGS)
+run_cached(C-flags)
+unset(RunCMake_TEST_OPTIONS)
+
+# An entry is not used once its compiler has changed on disk.
+if(CMAKE_HOST_UNIX)
+  file(STRINGS "${RunCMake_BINARY_DIR}/C-build/CMakeCache.txt" compilerEntry
+    REGEX "^CMAKE_C_COMPILER:FILEPATH=")
+  string(REGEX REPLACE "^[^=]*=" "" compiler "${compilerEntry}")
+  set(wrapper "${RunCMake_BINARY_DIR}/cc-wrapper")
+  file(WRITE "${wrapper}" "#!/bin/sh\nexec \"${compiler}\" \"$@\"\n")
+  file(CHMOD "${wrapper}" PERMISSIONS OWNER_READ OWNER_WRITE OWNER_EXECUTE)
+  set(RunCMake_TEST_OPTIONS -DCMAKE_C_COMPILER=${wrapper})
+  run_cmake(C-wrapper)
+  file(APPEND "${wrapper}" "# changed\n")
+  run_cached(C-wrapper-changed)
+  run_cached(C-wrapper-again)
+  unset(RunCMake_TEST_OPTIONS)
+endif()
+
+unset(ENV{CMAKE_COMPILER_ID_CACHE_DIR})
@@ -0,0 +1,3 @@
+cmake_import_targets(JSON [[{"targets":[
+  {"name":"x","type":1,"properties":{"P":"v"}}
+]}]])
@@ -0,0 +1,3 @@
+cmake_import_targets(JSON [[{"targets":[
+  {"name":"missing","properties":{"P":"v"}}
+]}]])
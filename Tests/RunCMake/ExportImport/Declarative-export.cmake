@@ -0,0 +1,19 @@
+enable_language(C)
+
+set(CMAKE_EXPORT_DECLARATIVE_TARGETS ON)
+
+add_library(iface INTERFACE)
+set_target_properties(iface PROPERTIES
+  EXPORT_PROPERTIES custom
+  custom "a;b \"c\" \\ \${d} ]=]"
+  )
+add_library(mainlib STATIC foo.c)
+target_compile_definitions(mainlib INTERFACE
+  $<BUILD_INTERFACE:BUILD_INTERFACE>
+  $<INSTALL_INTERFACE:INSTALL_INTERFACE>
+  )
+target_link_libraries(mainlib INTERFACE iface)
+
+install(TARGETS mainlib iface EXPORT export)
+install(EXPORT export DESTINATION lib/cmake/install FILE install-config.cmake NAMESPACE install::)
+export(EXPORT export FILE build-config.cmake NAMESPACE build::)
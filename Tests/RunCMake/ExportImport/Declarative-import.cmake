@@ -0,0 +1,33 @@
+enable_language(C)
+
+find_package(build REQUIRED)
+find_package(install REQUIRED)
+
+foreach(ns IN ITEMS build install)
+  file(READ "${${ns}_DIR}/${ns}-config.cmake" content)
+  if(NOT content MATCHES "cmake_import_targets\\(JSON")
+    message(SEND_ERROR "${ns}-config.cmake does not use cmake_import_targets")
+  endif()
+  get_property(type TARGET ${ns}::mainlib PROPERTY TYPE)
+  get_property(imported TARGET ${ns}::mainlib PROPERTY IMPORTED)
+  get_property(configs TARGET ${ns}::mainlib PROPERTY IMPORTED_CONFIGURATIONS)
+  get_property(custom TARGET ${ns}::iface PROPERTY custom)
+  if(NOT type STREQUAL "STATIC_LIBRARY" OR NOT imported OR
+      NOT "DEBUG" IN_LIST configs OR
+      NOT custom STREQUAL "a;b \"c\" \\ \${d} ]=]")
+    message(SEND_ERROR "${ns} targets imported incorrectly:\n"
+      " ${type}\n ${imported}\n ${configs}\n ${custom}")
+  endif()
+endforeach()
+
+get_property(location TARGET install::mainlib PROPERTY IMPORTED_LOCATION_DEBUG)
+get_filename_component(prefix "${install_DIR}/../../.." ABSOLUTE)
+string(FIND "${location}" "${prefix}/lib/" pos)
+if(NOT pos EQUAL 0)
+  message(SEND_ERROR "install::mainlib is not under the prefix:\n ${location}")
+endif()
+
+add_library(buildlib STATIC buildlib.c)
+target_link_libraries(buildlib PRIVATE build::mainlib)
+add_library(installlib STATIC installlib.c)
+target_link_libraries(installlib PRIVATE install::mainlib)
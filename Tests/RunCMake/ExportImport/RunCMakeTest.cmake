@@ -47,3 +47,9 @@ function(run_ExportImportBuildInstall_test case)
 endfunction()
 
 run_ExportImportBuildInstall_test(BuildInstallInterfaceGenex)
+run_ExportImportBuildInstall_test(Declarative)
+
+run_cmake(Declarative-BadPropertyValue)
+run_cmake(Declarative-BadType)
+run_cmake(Declarative-BadImportCheckFile)
+run_cmake(Declarative-MissingTarget)
@@ -0,0 +1,36 @@
+include(RunCMake)
+
+# Only the tested commands use the cache, so that it holds no entries
+# for the files of this test driver.
+set(ListFileCache_DIR "${RunCMake_BINARY_DIR}/cache")
+file(REMOVE_RECURSE "${ListFileCache_DIR}")
+set(cmake_cached ${CMAKE_COMMAND} -E env CMAKE_LIST_FILE_CACHE_DIR=${ListFileCache_DIR} ${CMAKE_COMMAND})
+
+run_cmake_command(SyntaxWarning ${cmake_cached} -P ${RunCMake_SOURCE_DIR}/SyntaxWarning.cmake)
+run_cmake_command(SyntaxWarning-again ${cmake_cached} -P ${RunCMake_SOURCE_DIR}/SyntaxWarning.cmake)
+
+run_cmake_command(Script ${cmake_cached} -P ${RunCMake_SOURCE_DIR}/Script.cmake)
+run_cmake_command(Script-cached ${cmake_cached} -P ${RunCMake_SOURCE_DIR}/Script.cmake)
+
+# An edited file does not use the entry of its old content.
+set(script "${RunCMake_BINARY_DIR}/Edited.cmake")
+file(GLOB entries_0 "${ListFileCache_DIR}/*.lfc")
+file(WRITE "${script}" "message(\"Edited 1\")\n")
+run_cmake_command(Edited-1 ${cmake_cached} -P ${script})
+file(GLOB entries_1 "${ListFileCache_DIR}/*.lfc")
+file(WRITE "${script}" "message(\"Edited 2\")\n")
+run_cmake_command(Edited-2 ${cmake_cached} -P ${script})
+file(GLOB entries_2 "${ListFileCache_DIR}/*.lfc")
+
+# A file whose content has an entry is loaded from it instead of being
+# parsed.  Give the first content the entry of the second to see that.
+list(REMOVE_ITEM entries_2 ${entries_1})
+list(REMOVE_ITEM entries_1 ${entries_0})
+list(LENGTH entries_1 n1)
+list(LENGTH entries_2 n2)
+if(NOT n1 EQUAL 1 OR NOT n2 EQUAL 1)
+  message(FATAL_ERROR "Expected one new cache entry per edit, not ${n1} and ${n2}")
+endif()
+file(COPY_FILE "${entries_2}" "${entries_1}")
+file(WRITE "${script}" "message(\"Edited 1\")\n")
+run_cmake_command(Edited-cached ${cmake_cached} -P ${script})
@@ -0,0 +1,5 @@
+file(GLOB entries "${ListFileCache_DIR}/*.lfc")
+list(LENGTH entries n)
+if(NOT n EQUAL 1)
+  set(RunCMake_TEST_FAILED "Expected one cache entry for Script.cmake, not ${n}")
+endif()
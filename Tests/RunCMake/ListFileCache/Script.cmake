@@ -0,0 +1,5 @@
+foreach(i RANGE 1 3)
+  if(i EQUAL 2)
+    message("Script ran [[${i}]]")
+  endif()
+endforeach()
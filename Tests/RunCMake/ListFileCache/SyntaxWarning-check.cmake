@@ -0,0 +1,4 @@
+file(GLOB entries "${ListFileCache_DIR}/*.lfc")
+if(entries)
+  set(RunCMake_TEST_FAILED "Cache entry created for file with a warning:\n  ${entries}")
+endif()
@@ -0,0 +1 @@
+message("Quoted"Unquoted)
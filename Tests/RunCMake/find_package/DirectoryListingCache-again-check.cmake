@@ -0,0 +1,15 @@
+if(NOT EXISTS "${RunCMake_TEST_BINARY_DIR}/CMakeFiles/DirectoryListings.cache")
+  set(RunCMake_TEST_FAILED "Expected the directory listings to be saved")
+  return()
+endif()
+file(STRINGS ${DirectoryListingCacheProfile} cacheHits
+  REGEX [=["hits"[ ]*:[ ]*[1-9]]=])
+if(NOT cacheHits)
+  set(RunCMake_TEST_FAILED "Expected directory_listing_cache hits")
+  return()
+endif()
+file(STRINGS ${DirectoryListingCacheProfile} findEntry
+  REGEX [["cat"[ ]*:[ ]*"find"]])
+if(NOT findEntry)
+  set(RunCMake_TEST_FAILED "Expected a find entry")
+endif()
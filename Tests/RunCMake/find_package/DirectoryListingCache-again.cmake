@@ -0,0 +1 @@
+include(DirectoryListingCache.cmake)
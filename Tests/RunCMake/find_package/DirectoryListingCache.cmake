@@ -0,0 +1,5 @@
+# Search the package again even if a previous run found it.
+unset(SearchPaths_DIR CACHE)
+find_package(SearchPaths REQUIRED CONFIG
+  PATHS ${CMAKE_CURRENT_SOURCE_DIR}/SearchPaths/prefix_pkg_cmake_pkg
+  NO_DEFAULT_PATH)
@@ -0,0 +1,19 @@
+# A package configuration file created after a search that did not
+# find it is found by a later search of the same directories.
+set(prefix "${CMAKE_CURRENT_BINARY_DIR}/LatePrefix")
+file(MAKE_DIRECTORY "${prefix}/lib/cmake")
+find_package(Late CONFIG QUIET PATHS "${prefix}" NO_DEFAULT_PATH)
+if(Late_FOUND)
+  message(FATAL_ERROR "Late found before it was created")
+endif()
+
+file(WRITE "${prefix}/lib/cmake/Late/LateConfig.cmake" "")
+file(WRITE "${prefix}/lib/cmake/Late/LateConfigVersion.cmake" [[
+set(PACKAGE_VERSION 1.2)
+set(PACKAGE_VERSION_COMPATIBLE TRUE)
+]])
+unset(Late_DIR CACHE)
+find_package(Late 1.0 CONFIG REQUIRED PATHS "${prefix}" NO_DEFAULT_PATH)
+if(NOT Late_VERSION VERSION_EQUAL 1.2)
+  message(FATAL_ERROR "Late version file not loaded")
+endif()
@@ -106,6 +106,18 @@ foreach(TestCasePrefix IN LISTS SearchPaths_TEST_CASE_LIST)
   endif()
 endforeach()
 
+run_cmake(LateConfig)
+
+block()
+  # A second configure reuses the directory listings of the first one.
+  set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/DirectoryListingCache-build)
+  run_cmake_with_options(DirectoryListingCache -DCMAKE_FIND_DIRECTORY_LISTING_CACHE=ON)
+  set(RunCMake_TEST_NO_CLEAN 1)
+  set(DirectoryListingCacheProfile ${RunCMake_BINARY_DIR}/DirectoryListingCache-profile.json)
+  set(RunCMake_TEST_OPTIONS --profiling-format=google-trace --profiling-output=${DirectoryListingCacheProfile})
+  run_cmake(DirectoryListingCache-again)
+endblock()
+
 if(UNIX
     AND NOT MSYS # FIXME: This works on CYGWIN but not on MSYS
     )
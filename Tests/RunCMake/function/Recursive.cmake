@@ -0,0 +1,14 @@
+# Call a function from its own body.  Run under LeakSanitizer, as in the
+# memcheck builds, this also checks that the body of a recursive function
+# does not keep itself alive through the lookup of its own command.
+function(count_down n)
+  if(n GREATER 0)
+    math(EXPR m "${n} - 1")
+    count_down(${m})
+    set(calls "${n};${calls}" PARENT_SCOPE)
+  endif()
+endfunction()
+count_down(3)
+if(NOT calls STREQUAL "3;2;1;")
+  message(FATAL_ERROR "count_down(3) made the calls: ${calls}")
+endif()
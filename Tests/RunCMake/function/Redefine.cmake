@@ -0,0 +1,31 @@
+# Redefine a command between executions of the same call site.
+foreach(i RANGE 1 3)
+  function(f)
+    set(value ${i} PARENT_SCOPE)
+  endfunction()
+  f()
+  if(NOT value EQUAL i)
+    message(FATAL_ERROR "f() called a stale definition: ${value} != ${i}")
+  endif()
+endforeach()
+
+# Call the previous definition of a redefined command.
+function(g)
+  set(value "g1" PARENT_SCOPE)
+endfunction()
+function(call_g)
+  g()
+  set(value "${value}" PARENT_SCOPE)
+endfunction()
+call_g()
+if(NOT value STREQUAL "g1")
+  message(FATAL_ERROR "g() called a stale definition: ${value}")
+endif()
+function(g)
+  _g()
+  set(value "${value};g2" PARENT_SCOPE)
+endfunction()
+call_g()
+if(NOT value STREQUAL "g1;g2")
+  message(FATAL_ERROR "g() called a stale definition: ${value}")
+endif()
@@ -1,3 +1,5 @@
 include(RunCMake)
 
 run_cmake(CMAKE_CURRENT_FUNCTION)
+run_cmake(Redefine)
+run_cmake(Recursive)
@@ -0,0 +1,77 @@
+cmake_minimum_required(VERSION 3.24)
+
+# Conditions of the same shape are evaluated many times with different
+# values, so each shape must give the results of its own values.
+set(truthTable
+  "0,0,0,0,1"
+  "0,1,0,1,1"
+  "1,0,0,1,0"
+  "1,1,1,1,0"
+  )
+foreach(row IN LISTS truthTable)
+  string(REPLACE "," ";" row "${row}")
+  list(GET row 0 a)
+  list(GET row 1 b)
+  list(GET row 2 expectAnd)
+  list(GET row 3 expectOr)
+  list(GET row 4 expectNotA)
+
+  set(gotAnd 0)
+  if(a AND b)
+    set(gotAnd 1)
+  endif()
+  set(gotOr 0)
+  if((a) OR (b))
+    set(gotOr 1)
+  endif()
+  set(gotNotA 0)
+  if(NOT (a AND 1))
+    set(gotNotA 1)
+  endif()
+  if(NOT "${gotAnd};${gotOr};${gotNotA}" STREQUAL
+      "${expectAnd};${expectOr};${expectNotA}")
+    message(SEND_ERROR "Unexpected results for a=${a} b=${b}: "
+      "${gotAnd};${gotOr};${gotNotA}")
+  endif()
+endforeach()
+
+# Unary and binary operators within nested parentheses.
+set(defined_var 1)
+foreach(v IN ITEMS 1.2 2.0 10)
+  if(DEFINED defined_var AND (v VERSION_LESS 2 OR NOT (v MATCHES "^1")))
+    list(APPEND picked ${v})
+  endif()
+  if(v MATCHES "^([0-9]+)")
+    list(APPEND majors ${CMAKE_MATCH_1})
+  endif()
+endforeach()
+if(NOT picked STREQUAL "1.2;2.0")
+  message(SEND_ERROR "Unexpected picked versions: ${picked}")
+endif()
+if(NOT majors STREQUAL "1;2;10")
+  message(SEND_ERROR "Unexpected majors: ${majors}")
+endif()
+
+# A loop condition is evaluated on every iteration.
+set(i 0)
+while(i LESS 5 AND NOT i EQUAL 3)
+  math(EXPR i "${i} + 1")
+endwhile()
+if(NOT i EQUAL 3)
+  message(SEND_ERROR "Unexpected loop count: ${i}")
+endif()
+
+# Quoted keywords are operators with the OLD behavior of CMP0054.
+set(listVar "x;y")
+cmake_policy(PUSH)
+set(CMAKE_WARN_DEPRECATED OFF)
+cmake_policy(SET CMP0054 OLD)
+if(NOT ("y" "IN_LIST" listVar))
+  message(SEND_ERROR "Quoted IN_LIST is not an operator with CMP0054 OLD")
+endif()
+cmake_policy(POP)
+if(NOT ("y" IN_LIST listVar) OR "z" IN_LIST listVar)
+  message(SEND_ERROR "Unexpected IN_LIST result with CMP0054 NEW")
+endif()
+
+message(STATUS "Conditions evaluated as expected")
@@ -28,3 +28,4 @@ run_cmake(TestNameThatExists)
 run_cmake(TestNameThatDoesNotExist)
 
 run_cmake_script(AndOr)
+run_cmake_script(ConditionShapes)
@@ -0,0 +1,10 @@
+# Rewrite an included file with content of the same size within the
+# resolution of file timestamps and verify the new content is used.
+set(file "${CMAKE_CURRENT_BINARY_DIR}/rewritten.cmake")
+foreach(i RANGE 1 5)
+  file(WRITE "${file}" "set(value ${i})\n")
+  include("${file}")
+  if(NOT value EQUAL i)
+    message(FATAL_ERROR "include() read stale content: ${value} != ${i}")
+  endif()
+endforeach()
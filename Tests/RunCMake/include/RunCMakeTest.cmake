@@ -7,6 +7,7 @@ run_cmake(CMP0024-NEW)
 run_cmake(ExportExportInclude)
 run_cmake(IncludeIsDirectory)
 run_cmake(IncludeMalformed)
+run_cmake(IncludeRewritten)
 
 run_cmake(CMP0146-OLD)
 run_cmake(CMP0146-WARN)
@@ -0,0 +1,38 @@
+set(srcs a.c)
+set(copy "${srcs}")
+function(append_sources)
+  list(APPEND srcs b.c)
+  list(APPEND srcs c.c d.c)
+  if(NOT srcs STREQUAL "a.c;b.c;c.c;d.c")
+    message(FATAL_ERROR "list(APPEND) in a function set srcs to \"${srcs}\"")
+  endif()
+  set(srcs "${srcs}" PARENT_SCOPE)
+endfunction()
+append_sources()
+list(APPEND srcs e.c)
+if(NOT srcs STREQUAL "a.c;b.c;c.c;d.c;e.c" OR NOT copy STREQUAL "a.c")
+  message(FATAL_ERROR "list(APPEND) set srcs to \"${srcs}\" and copy to \"${copy}\"")
+endif()
+
+set(empty "")
+list(APPEND empty x)
+list(APPEND undefined x)
+if(NOT empty STREQUAL "x" OR NOT undefined STREQUAL "x")
+  message(FATAL_ERROR "list(APPEND) set empty to \"${empty}\" and undefined to \"${undefined}\"")
+endif()
+
+set(cached_list a CACHE STRING "")
+list(APPEND cached_list b)
+if(NOT cached_list STREQUAL "a;b" OR NOT "$CACHE{cached_list}" STREQUAL "a")
+  message(FATAL_ERROR "list(APPEND) set cached_list to \"${cached_list}\"")
+endif()
+
+# Many appends to one list must stay linear in its length.
+foreach(i RANGE 1 20000)
+  list(APPEND many src/file_${i}.c)
+endforeach()
+list(LENGTH many n)
+list(GET many 19999 last)
+if(NOT n EQUAL 20000 OR NOT last STREQUAL "src/file_20000.c")
+  message(FATAL_ERROR "list(APPEND) gave ${n} elements ending in \"${last}\"")
+endif()
@@ -25,6 +25,7 @@ run_cmake(SUBLIST-TooManyArguments)
 run_cmake(REMOVE_AT-EmptyList)
 
 run_cmake(REMOVE_DUPLICATES-PreserveOrder)
+run_cmake(APPEND-Scopes)
 
 run_cmake(FILTER-NotList)
 run_cmake(REMOVE_AT-NotList)
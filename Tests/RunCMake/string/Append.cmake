@@ -56,3 +56,22 @@ ${c}]])
 if(NOT out STREQUAL "xab\${c}")
   message(FATAL_ERROR "\"string(APPEND out a \"\${b}\" [[\${c}]])\" set out to \"${out}\"")
 endif()
+
+set(out x)
+function(append_in_function)
+  string(APPEND out a)
+  string(APPEND out b)
+  if(NOT out STREQUAL "xab")
+    message(FATAL_ERROR "\"string(APPEND out)\" in a function set out to \"${out}\"")
+  endif()
+endfunction()
+append_in_function()
+if(NOT out STREQUAL "x")
+  message(FATAL_ERROR "\"string(APPEND out)\" in a function changed out to \"${out}\"")
+endif()
+
+set(cached_out x CACHE STRING "")
+string(APPEND cached_out a)
+if(NOT cached_out STREQUAL "xa" OR NOT "$CACHE{cached_out}" STREQUAL "x")
+  message(FATAL_ERROR "\"string(APPEND cached_out a)\" set cached_out to \"${cached_out}\"")
+endif()
@@ -0,0 +1,4 @@
+try_compile(RESULT
+  PROBE HAVE_A probe.c "int main(void) { return 0; }\n"
+  PROBE HAVE_B probe.c "#error fails\n"
+  )
@@ -0,0 +1,4 @@
+try_compile(RESULT
+  SOURCE_FROM_CONTENT common.c "int common(void) { return 0; }\n"
+  PROBE HAVE_A common.c "int main(void) { return 0; }\n"
+  )
@@ -0,0 +1 @@
+try_compile(RESULT PROBE HAVE_TEST test.c)
@@ -0,0 +1,46 @@
+enable_language(C)
+
+try_compile(RESULT
+  SOURCE_FROM_CONTENT common.c "int probe_value(void) { return 1; }\n"
+  PROBE HAVE_FIRST first.c "int probe_value(void);\nint main(void) { return probe_value() - 1; }\n"
+  PROBE HAVE_BROKEN broken.c "#error broken\n"
+  PROBE HAVE_LAST last.c "int main(void) { return 0; }\n"
+  OUTPUT_VARIABLE out
+  NO_CACHE
+  )
+if(RESULT)
+  message(SEND_ERROR "try_compile with a broken probe succeeded")
+endif()
+if(NOT HAVE_FIRST)
+  message(SEND_ERROR "probe first.c failed:\n${out}")
+endif()
+if(HAVE_BROKEN)
+  message(SEND_ERROR "probe broken.c succeeded")
+endif()
+if(NOT HAVE_LAST)
+  message(SEND_ERROR "probe last.c failed:\n${out}")
+endif()
+if(DEFINED CACHE{HAVE_FIRST})
+  message(SEND_ERROR "probe result cached despite NO_CACHE")
+endif()
+
+try_compile(RESULT
+  PROBE HAVE_DEFINED defined.c "#ifndef PROBE_DEFINED\n#error undefined\n#endif\nint main(void) { return 0; }\n"
+  COMPILE_DEFINITIONS -DPROBE_DEFINED
+  )
+if(NOT RESULT OR NOT HAVE_DEFINED)
+  message(SEND_ERROR "try_compile with only passing probes failed")
+endif()
+
+# Probes are built at a bounded parallel level.
+set(ENV{CMAKE_BUILD_PARALLEL_LEVEL} 3)
+try_compile(RESULT
+  PROBE HAVE_JOBS jobs.c "int main(void) { return 0; }\n"
+  OUTPUT_VARIABLE out
+  NO_CACHE
+  )
+unset(ENV{CMAKE_BUILD_PARALLEL_LEVEL})
+if(CMAKE_GENERATOR MATCHES "^(Unix Makefiles|Ninja|Ninja Multi-Config)$"
+    AND NOT out MATCHES "Run Build Command\\(s\\):[^\n]* -j ?3[ \n]")
+  message(SEND_ERROR "probes not built at the requested parallel level:\n${out}")
+endif()
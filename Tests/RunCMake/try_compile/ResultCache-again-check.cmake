@@ -0,0 +1,12 @@
+file(READ ${ResultCacheProfile} profile)
+if(NOT profile MATCHES "\"args\"[ ]*:[ \t\r\n]*{([^}]*)}[ \t\r\n]*,[ \t\r\n]*\"name\"[ ]*:[ ]*\"try_compile_cache\"")
+  set(RunCMake_TEST_FAILED "Expected a try_compile_cache counter")
+  return()
+endif()
+set(counters "${CMAKE_MATCH_1}")
+# The failed try_compile is not cached, so it is the only miss.
+if(NOT counters MATCHES "\"hits\"[ ]*:[ ]*[1-9]")
+  set(RunCMake_TEST_FAILED "Expected try_compile_cache hits")
+elseif(NOT counters MATCHES "\"misses\"[ ]*:[ ]*1[^0-9]")
+  set(RunCMake_TEST_FAILED "Expected 1 try_compile_cache miss")
+endif()
@@ -0,0 +1,2 @@
+set(ResultCache_VALUE 5)
+include(${CMAKE_CURRENT_LIST_DIR}/ResultCache-generated.cmake)
@@ -0,0 +1,13 @@
+enable_language(C)
+
+# Each build tree generates its own header of the same name.
+file(WRITE "${CMAKE_BINARY_DIR}/generated/result_cache_generated.h"
+  "#define RESULT_GENERATED ${ResultCache_VALUE}\n")
+try_run(RUN_RESULT COMPILE_RESULT SOURCE_FROM_CONTENT generated.c
+  "#include <result_cache_generated.h>\nint main(void) { return RESULT_GENERATED; }\n"
+  CMAKE_FLAGS "-DINCLUDE_DIRECTORIES=${CMAKE_BINARY_DIR}/generated"
+  NO_CACHE
+  )
+if(NOT COMPILE_RESULT OR NOT RUN_RESULT EQUAL ResultCache_VALUE)
+  message(SEND_ERROR "try_run of generated.c returned '${COMPILE_RESULT}' and '${RUN_RESULT}'")
+endif()
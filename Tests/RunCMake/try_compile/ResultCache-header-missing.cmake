@@ -0,0 +1,2 @@
+set(expect FALSE)
+include(${CMAKE_CURRENT_LIST_DIR}/ResultCache-header.cmake)
@@ -0,0 +1,12 @@
+enable_language(C)
+
+try_compile(RESULT_HEADER SOURCE_FROM_CONTENT header.c
+  "#include <result_cache_header.h>\nint main(void) { return RESULT_CACHE_HEADER; }\n"
+  CMAKE_FLAGS "-DINCLUDE_DIRECTORIES=${ResultCache_INCLUDE_DIR}"
+  NO_CACHE
+  )
+if(RESULT_HEADER AND NOT expect)
+  message(SEND_ERROR "try_compile of header.c succeeded without the header")
+elseif(NOT RESULT_HEADER AND expect)
+  message(SEND_ERROR "try_compile of header.c failed with the header")
+endif()
@@ -0,0 +1,10 @@
+file(READ ${ResultCacheProfile} profile)
+if(NOT profile MATCHES "\"args\"[ ]*:[ \t\r\n]*{([^}]*)}[ \t\r\n]*,[ \t\r\n]*\"name\"[ ]*:[ ]*\"try_compile_cache\"")
+  set(RunCMake_TEST_FAILED "Expected a try_compile_cache counter")
+  return()
+endif()
+set(counters "${CMAKE_MATCH_1}")
+# The changed definition selects another entry.
+if(NOT counters MATCHES "\"misses\"[ ]*:[ ]*1[^0-9]")
+  set(RunCMake_TEST_FAILED "Expected 1 try_compile_cache miss")
+endif()
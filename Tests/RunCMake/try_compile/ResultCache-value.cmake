@@ -0,0 +1,10 @@
+enable_language(C)
+
+try_run(RUN_RESULT COMPILE_RESULT SOURCE_FROM_CONTENT value.c
+  "int main(void) { return RESULT_VALUE; }\n"
+  COMPILE_DEFINITIONS -DRESULT_VALUE=${ResultCache_VALUE}
+  NO_CACHE
+  )
+if(NOT COMPILE_RESULT OR NOT RUN_RESULT EQUAL ResultCache_VALUE)
+  message(SEND_ERROR "try_run of value.c returned '${COMPILE_RESULT}' and '${RUN_RESULT}'")
+endif()
@@ -0,0 +1,30 @@
+enable_language(C)
+
+try_compile(RESULT_WORKS SOURCE_FROM_CONTENT works.c "int main(void) { return 0; }\n"
+  COPY_FILE "${CMAKE_CURRENT_BINARY_DIR}/works"
+  NO_CACHE
+  )
+if(NOT RESULT_WORKS)
+  message(SEND_ERROR "try_compile of works.c failed")
+endif()
+if(NOT EXISTS "${CMAKE_CURRENT_BINARY_DIR}/works")
+  message(SEND_ERROR "try_compile did not copy the output of works.c")
+endif()
+
+try_compile(RESULT_FAILS SOURCE_FROM_CONTENT fails.c "#error fails\n"
+  OUTPUT_VARIABLE out
+  NO_CACHE
+  )
+if(RESULT_FAILS)
+  message(SEND_ERROR "try_compile of fails.c succeeded")
+endif()
+if(NOT out MATCHES "fails")
+  message(SEND_ERROR "try_compile output of fails.c is missing the error:\n${out}")
+endif()
+
+try_run(RUN_RESULT COMPILE_RESULT SOURCE_FROM_CONTENT run.c "int main(void) { return 3; }\n"
+  NO_CACHE
+  )
+if(NOT COMPILE_RESULT OR NOT RUN_RESULT EQUAL 3)
+  message(SEND_ERROR "try_run of run.c returned '${COMPILE_RESULT}' and '${RUN_RESULT}'")
+endif()
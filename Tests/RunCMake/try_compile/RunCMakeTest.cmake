@@ -41,6 +41,10 @@ run_cmake(SourceFromOneArg)
 run_cmake(SourceFromThreeArgs)
 run_cmake(SourceFromBadName)
 run_cmake(SourceFromBadFile)
+run_cmake(ProbeTwoArgs)
+run_cmake(ProbeRepeatedName)
+run_cmake(ProbeSourceName)
+run_cmake(Probes)
 
 run_cmake(ProjectCopyFile)
 run_cmake(NonSourceCopyFile)
@@ -124,3 +128,30 @@ endif()
 if(UNIX)
   run_cmake(CleanupNoFollowSymlink)
 endif()
+
+if(NOT CMAKE_SYSTEM_NAME MATCHES "^(Android|WindowsCE|WindowsPhone|WindowsStore)$")
+  # A second build tree reuses the results cached by the first one.
+  set(ENV{CMAKE_TRY_COMPILE_CACHE_DIR} "${RunCMake_BINARY_DIR}/ResultCache-cache")
+  file(REMOVE_RECURSE "${RunCMake_BINARY_DIR}/ResultCache-cache")
+  run_cmake(ResultCache)
+  set(ResultCacheProfile "${RunCMake_BINARY_DIR}/ResultCache-again-profile.json")
+  set(RunCMake_TEST_OPTIONS --profiling-format=google-trace --profiling-output=${ResultCacheProfile})
+  run_cmake(ResultCache-again)
+  # A failed check is not cached, so it succeeds once its header exists.
+  set(ResultCache_INCLUDE_DIR "${RunCMake_BINARY_DIR}/ResultCache-include")
+  file(REMOVE_RECURSE "${ResultCache_INCLUDE_DIR}")
+  set(RunCMake_TEST_OPTIONS -DResultCache_INCLUDE_DIR=${ResultCache_INCLUDE_DIR})
+  run_cmake(ResultCache-header-missing)
+  file(WRITE "${ResultCache_INCLUDE_DIR}/result_cache_header.h" "#define RESULT_CACHE_HEADER 0\n")
+  run_cmake(ResultCache-header-found)
+  # A changed definition does not reuse the result for the old one.
+  run_cmake(ResultCache-value-3)
+  set(ResultCacheProfile "${RunCMake_BINARY_DIR}/ResultCache-value-5-profile.json")
+  set(RunCMake_TEST_OPTIONS --profiling-format=google-trace --profiling-output=${ResultCacheProfile})
+  run_cmake(ResultCache-value-5)
+  unset(RunCMake_TEST_OPTIONS)
+  # A header generated in another build tree does not reuse the result.
+  run_cmake(ResultCache-generated-3)
+  run_cmake(ResultCache-generated-5)
+  unset(ENV{CMAKE_TRY_COMPILE_CACHE_DIR})
+endif()